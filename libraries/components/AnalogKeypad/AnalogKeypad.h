@@ -115,6 +115,10 @@ enum class ButtonTag;       // Forward decl, button tags are user-defined.
 // Type that encapsulates behaviors of a keypad attached to an analog GPIO input.
 class Keypad : public IClockable, public IComponent
 {
+    // Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+    template <class T>
+    friend void clockReceiver(T&);
+
 public:
     // Enumerates valid keypad events.
     enum class Event
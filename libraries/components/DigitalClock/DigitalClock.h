@@ -68,6 +68,10 @@
 // Type that encapsulates the behavior of a digital clock.
 class DigitalClock : public IClockable, public IComponent, public ISerializeable  
 {
+	// Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+	template <class T>
+	friend void clockReceiver(T&);
+
 public:
 	// Enumerates the valid operating modes.
 	enum class Mode 
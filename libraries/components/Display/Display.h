@@ -51,6 +51,10 @@
 
 class Display : public IComponent, public IClockable
 {
+	// Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+	template <class T>
+	friend void clockReceiver(T&);
+
 public:
 	// Type that encapsulates information about a display field.
 	struct Field
@@ -36,6 +36,10 @@
 // Asynchronous rotary actuator controller class.
 class RotaryActuator : public IComponent, public IClockable
 {
+	// Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+	template <class T>
+	friend void clockReceiver(T&);
+
 public:
 	using angle_t = IServo::angle_t;							// Type that stores rotation angles in degrees.
 	static const angle_t InvalidAngle = IServo::InvalidAngle;	// Constant indicating an invalid angle.
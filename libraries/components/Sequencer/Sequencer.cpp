@@ -150,6 +150,8 @@ void Sequencer::begin()
 	event_timer_.interval((*current_)->duration_);
 	if((*current_)->command_)
 		(*current_)->command_->execute();
+	else if ((*current_)->delegate_)
+		(*current_)->delegate_();
 	callback(current_, Event::State::Begin);
 }
 
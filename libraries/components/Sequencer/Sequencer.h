@@ -34,7 +34,9 @@
  *		event sequencer. It executes a collection of Command objects (see 
  *		<ICommand.h>) in order at specified intervals. Events are encapsulated 
  *		in the nested `Event' type and have three properties: a human readable 
- *		name, a duration and the Command object that executes the event. 
+ *		name, a duration and the Command object that executes the event. An 
+ *		event may instead be executed by a `Delegate' (see <Delegate.h>), 
+ *		which is called if the event has no Command object. 
  *		Clients pass a collection of `Event' objects to the `Sequencer' at 
  *		time of construction and use its member methods to control execution.
  *		`Sequencer' objects can be operated synchronously with the `tick()' 
@@ -58,11 +60,16 @@
 # include "array.h"				// `ArrayWrapper' type, `std_distance()'
 # include "IComponent.h"		// `IComponent' interface.
 # include "IClockable.h"		// `IClockable" and `ICommand' interfaces.
+# include "Delegate.h"			// `Delegate' type.
 # include "Timer.h"				// `Timer' class.
 
 // Type that asynchronously executes a sequence of commands objects.
 class Sequencer : public IClockable, public IComponent 
 {
+	// Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+	template <class T>
+	friend void clockReceiver(T&);
+
 public:
 	// Encapsulates information about an event.
 	struct Event 
@@ -74,9 +81,10 @@ public:
 			End			// State at the completion of an event.
 		};
 
-		const char* name_;		// Human-readable name.
-		msecs_t		duration_;	// Duration in milliseconds.
-		ICommand*	command_;	// Event command object.
+		const char*			name_;		// Human-readable name.
+		msecs_t				duration_;	// Duration in milliseconds.
+		ICommand*			command_;	// Event command object.
+		Delegate<void()>	delegate_;	// Event delegate, called if there is no command object.
 	};
 
 	// Enumerates the valid sequencer states.
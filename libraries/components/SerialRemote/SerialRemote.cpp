@@ -2,13 +2,15 @@
 #include "SerialRemote.h"
 
 SerialRemote::SerialRemote(char* buf, size_t size_buf, const Command commands[], size_t size_cmds) :
-	commands_(commands, size_cmds), current_(std_end(commands_)), buf_(buf, size_buf), data_(buf_.begin()) 
+	commands_(commands, size_cmds), current_(std_end(commands_)), buf_(buf, size_buf), data_(buf_.begin()), 
+	key_max_(key_max()) 
 {
 	
 }
 
 SerialRemote::SerialRemote(char* buf_first, char* buf_last, const Command* cmd_first, const Command* cmd_last) :
-	commands_(cmd_first, cmd_last), current_(std_end(commands_)), buf_(buf_first, buf_last), data_(buf_.begin()) 
+	commands_(cmd_first, cmd_last), current_(std_end(commands_)), buf_(buf_first, buf_last), data_(buf_.begin()), 
+	key_max_(key_max()) 
 {
 	
 }
@@ -17,18 +19,27 @@ void SerialRemote::poll()
 {
 	if (Serial.available())
 	{
+		buf_iter first = data_;
+
 		data_ += Serial.readBytes(data_, std_distance(data_, buf_.end()));
+		match(first, data_);
 		if (*(data_ - 1U) == EndOfTextChar || data_ == buf_.end())
 		{
 			*(--data_) = '\0';
-			current_ = std_find(std_begin(commands_), std_end(commands_), buf());
+			// Measure the text once, here, so command matching and handlers needn't.
+			text_ = std_string_view(buf(), std_distance(buf_.begin(), data_));
+			// A key matched against the char just overwritten isn't in the text after all.
+			if (current_ != std_end(commands_) && current_->key().size() > text_.size())
+				current_ = std_find(std_begin(commands_), std_end(commands_), text_);
 			if (current_ != std_end(commands_))
 			{
-				current_->program()->execute();
+				current_->execute();
 				if (echo())
 					Serial.print(buf());
 			}
 			data_ = buf_.begin();
+			current_ = std_end(commands_);
+			hasher_.reset();
 		}
 	}
 }
@@ -43,6 +54,11 @@ const char* SerialRemote::buf() const
 	return buf_.data();
 }
 
+std_string_view SerialRemote::text() const
+{
+	return text_;
+}
+
 bool& SerialRemote::echo()
 {
 	return echo_;
@@ -56,4 +72,36 @@ const bool& SerialRemote::echo() const
 void SerialRemote::clock()
 {
 	poll();
+}
+
+void SerialRemote::match(buf_iter first, buf_iter last)
+{
+	// Keys are matched against the start of the text, so a key of length `n' can only match 
+	// when the `n'th char arrives. Each key's string is only compared if its hash matches.
+	for (size_t n = std_distance(buf_.begin(), first) + 1U; first != last && n <= key_max_; ++first, ++n)
+	{
+		hasher_.update(*first);
+		// Only commands ahead of the current match can replace it, as with `std_find()'.
+		for (commands_iter it = std_begin(commands_); it != current_; ++it)
+		{
+			if (it->key().size() == n && it->hash() == hasher_.value() && *it == std_string_view(buf(), n))
+			{
+				current_ = it;
+				break;
+			}
+		}
+	}
+}
+
+size_t SerialRemote::key_max() const
+{
+	size_t n = 0;
+
+	for (commands_iter it = std_begin(commands_); it != std_end(commands_); ++it)
+	{
+		if (it->key().size() > n)
+			n = it->key().size();
+	}
+
+	return n;
 }
\ No newline at end of file
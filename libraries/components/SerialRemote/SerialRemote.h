@@ -32,49 +32,115 @@
 
 # include <string.h>		// C-stdlib string functions.
 # include "array.h"			// STL fixed-size array types.
+# include "string_view.h"	// `std_string_view' type.
+# include "hash.h"			// `std_fnv1a_hasher' type.
 # include "IClockable.h"	// `IClockable' interface class.
 # include "IComponent.h"	// `IComponent' interface class.
+# include "Delegate.h"		// `Delegate' type.
 
 enum class CommandTag;	// Client-defined command tags.
 
 // Asynchronous serial command execution type.
 class SerialRemote : public IClockable, public IComponent
 {
+	// Lets `clockDelegate()' call `clock()' directly for `final' derived types.
+	template <class T>
+	friend void clockReceiver(T&);
+
 public:
 	// `SerialRemote' command type.
 	class Command
 	{
+	public:
+		// Command delegate type.
+		using delegate_type = Delegate<void()>;
+		// Command key hash type.
+		using hash_type = std_fnv1a_hasher::value_type;
+
 	public:
 		// Command constructor.
-		Command(CommandTag tag, const char* key, ICommand* program) : 
-			tag_(tag), key_(key), program_(program) 
+		Command(CommandTag tag, std_string_view key, ICommand* program) : 
+			tag_(tag), key_(key), hash_(hash(key)), program_(program), delegate_()
 		{
 			assert(program);
 		}
 
+		// Command delegate constructor.
+		Command(CommandTag tag, std_string_view key, delegate_type delegate) : 
+			tag_(tag), key_(key), hash_(hash(key)), program_(), delegate_(delegate)
+		{
+			assert(delegate);
+		}
+
 	public:
-		// Returns an immutable iterator to the command object.
+		// Returns an immutable iterator to the command object, if any.
 		ICommand* program() const
 		{
 			return program_;
 		}
 
-		// Compares a command's key string to another string.
+		// Returns the command delegate, which is empty if the command has a command object.
+		const delegate_type& delegate() const
+		{
+			return delegate_;
+		}
+
+		// Executes the command object or, if none, calls the delegate.
+		void execute() const
+		{
+			if (program_)
+				program_->execute();
+			else
+				delegate_();
+		}
+
+		// Returns the command's key string.
+		std_string_view key() const
+		{
+			return key_;
+		}
+
+		// Returns the FNV-1a hash of the command's key string.
+		hash_type hash() const
+		{
+			return hash_;
+		}
+
+		// Compares a command's key string to the start of another string.
 		bool operator==(const char* key) const
 		{
-			return !strncmp(key_, key, strlen(key_));
+			return !strncmp(key_.data(), key, key_.size());
+		}
+
+		// Compares a command's key string to the start of a string of known length.
+		bool operator==(std_string_view text) const
+		{
+			return text.starts_with(key_);
 		}
 
 		// Compares a command's key string to another command's key string.
 		bool operator==(const Command& other) const
 		{
-			return !strncmp(key_, other.key_, strlen(key_));
+			return other.key_.starts_with(key_);
+		}
+
+	private:
+		// Returns the FNV-1a hash of a key string.
+		static hash_type hash(std_string_view key)
+		{
+			std_fnv1a_hasher hasher;
+
+			hasher.update(key.data(), key.size());
+
+			return hasher.value();
 		}
 
 	private:
-		CommandTag	tag_;		// The command's identifying tag.
-		const char* key_;		// The command's key string.
-		ICommand*	program_;	// The command object to execute.
+		CommandTag		tag_;		// The command's identifying tag.
+		std_string_view key_;		// The command's key string.
+		hash_type		hash_;		// Hash of the key string, compared before the string itself.
+		ICommand*		program_;	// The command object to execute, if any.
+		delegate_type	delegate_;	// The delegate to call if there is no command object.
 	};
 
 	static const char EndOfTextChar = '\n';	// Character indicating end of text.
@@ -100,6 +166,8 @@ public:
 	char*		buf();
 	// Returns an immutable iterator to the read/write buffer.
 	const char* buf() const;
+	// Returns the most recently received command text, without the end-of-text char.
+	std_string_view text() const;
 	// Returns a mutable reference to the echo flag.
 	bool&		echo();
 	// Returns an immutable reference to the echo flag.
@@ -108,18 +176,25 @@ public:
 private:
 	// IClockable clock method implementation.
 	void clock() override;
+	// Hashes newly received chars and matches the text received so far against the command keys.
+	void match(buf_iter, buf_iter);
+	// Returns the length of the longest command key.
+	size_t key_max() const;
 
 private:
 	commands_type	commands_;	// The current command collection.
 	commands_iter	current_;	// Points to the currently matched command, if any. 
 	buf_type		buf_;		// Serial read/write buffer.
 	buf_iter		data_;		// Current read/write position.
+	std_string_view	text_;		// Most recently received command text.
+	std_fnv1a_hasher hasher_;	// Hash of the command text received so far.
+	size_t			key_max_;	// Length of the longest command key, texts aren't hashed past it.
 	bool			echo_;		// Flag indicating whether to echo the buffer after command execution.
 };
 
 template<size_t SizeBuf, size_t SizeCmds>
 SerialRemote::SerialRemote(char (&buf)[SizeBuf], const Command(&commands)[SizeCmds]) :
-	commands_(commands), current_(std_end(commands_)), buf_(buf), data_(buf_.begin()) 
+	commands_(commands), current_(std_end(commands_)), buf_(buf), data_(buf_.begin()), key_max_(key_max()) 
 {
 	
 }
@@ -0,0 +1,188 @@
+/*
+ *	This file defines a lightweight callable reference type.
+ *
+ *	***************************************************************************
+ *
+ *	File: Delegate.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	**************************************************************************
+ *
+ *	Description:
+ *
+ *	The `Delegate' type is a value type that refers to something callable: a
+ *	free-standing function, a member method bound to an object, or a lambda
+ *	or other function object. It consists of just two pointers, a context
+ *	pointer and a pointer to a "thunk" function generated by a template for
+ *	each kind of target, so it has no vtable, never allocates and can be
+ *	copied freely. Calling a delegate costs one indirect call through the
+ *	thunk, and a member method is called directly by the thunk rather than
+ *	through a pointer-to-member, since the method is a template argument.
+ *	This does not apply to virtual methods, which are still dispatched
+ *	through the object's vtable. A free-standing function taking the object
+ *	by reference can be bound instead, and calls a method of a `final' type
+ *	directly (see `clockDelegate()' in <IClockable.h>).
+ *
+ *	Delegates are a lighter alternative to `ICommand' objects (see
+ *	<ICommand.h>) for callbacks that need no state of their own, and are
+ *	accepted by `TaskScheduler', `Sequencer' and `SerialRemote' in addition
+ *	to `ICommand' pointers.
+ *
+ *	A delegate does not own its target. Bound objects and function objects
+ *	must outlive the delegate, which is why function objects can only be
+ *	bound as lvalues. Lambdas without captures are stored as plain function
+ *	pointers and may be temporaries.
+ *
+ *	Examples:
+ *
+ *		void blink();
+ *		struct Foo { void bar(); } foo;
+ *		auto lambda = [&foo]() { foo.bar(); };
+ *
+ *		Delegate<void()> d1(&blink);
+ *		Delegate<void()> d2 = Delegate<void()>::bind<Foo, &Foo::bar>(&foo);
+ *		Delegate<void()> d3(lambda);
+ *		Delegate<void()> d4([]() { blink(); });
+ *
+ *		d2();	// Calls foo.bar();
+ */
+
+#if !defined DELEGATE_H__
+# define DELEGATE_H__ 20261018L
+
+# include "types.h"				// `nullptr_t' type.
+# include "type_traits.h"		// `std_enable_if', `std_is_convertible'.
+# include "utility.h"			// `std_forward()'.
+
+template <class Signature>
+class Delegate;
+
+// Reference to a function, bound member method or function object with signature `R(Args...)'.
+template <class R, class ... Args>
+class Delegate<R(Args ...)>
+{
+public:
+	// Free-standing function type.
+	using function_type = R(*)(Args ...);
+
+private:
+	// Delegate target, either an object or a free-standing function.
+	union Context
+	{
+		void*			object;		// Bound object or function object.
+		function_type	function;	// Free-standing function.
+	};
+
+	// Calls the target in `context'.
+	using thunk_type = R(*)(const Context& context, Args&& ...);
+
+public:
+	// Constructs an empty delegate.
+	Delegate() : context_(), thunk_() {}
+	// Constructs an empty delegate.
+	Delegate(nullptr_t) : context_(), thunk_() {}
+	// Constructs a delegate that calls a free-standing function, or a lambda without captures.
+	template <class F, class = typename std_enable_if<std_is_convertible<F, function_type>::value>::type>
+	Delegate(F&& function) : context_(), thunk_()
+	{
+		context_.function = static_cast<function_type>(function);
+		thunk_ = context_.function ? &function_thunk : nullptr;
+	}
+	// Constructs a delegate that calls a function object, which must outlive the delegate.
+	template <class F, class = typename std_enable_if<!std_is_convertible<F&, function_type>::value &&
+		!std_is_same<typename std_remove_cv<F>::type, Delegate>::value>::type, class = void>
+	Delegate(F& object) : context_(), thunk_(&object_thunk<F>)
+	{
+		context_.object = const_cast<void*>(static_cast<const void*>(&object));
+	}
+
+public:
+	// Returns a delegate that calls the member method `Method' of `object'.
+	template <class Obj, R(Obj::*Method)(Args ...)>
+	static Delegate bind(Obj* object) { return Delegate(object, &method_thunk<Obj, Method>); }
+	// Returns a delegate that calls the const member method `Method' of `object'.
+	template <class Obj, R(Obj::*Method)(Args ...) const>
+	static Delegate bind(const Obj* object) { return Delegate(object, &const_method_thunk<Obj, Method>); }
+	// Returns a delegate that calls the free-standing function `Function' with `object'.
+	template <class Obj, R(*Function)(Obj&, Args ...)>
+	static Delegate bind(Obj* object) { return Delegate(object, &object_function_thunk<Obj, Function>); }
+	// Calls the target, which must not be empty.
+	R operator()(Args ... args) const { return (*thunk_)(context_, std_forward<Args>(args) ...); }
+	// Checks whether the delegate has a target.
+	explicit operator bool() const { return thunk_ != nullptr; }
+	// Checks whether two delegates have the same target.
+	bool operator==(const Delegate&) const;
+	// Checks whether two delegates have different targets.
+	bool operator!=(const Delegate& other) const { return !(*this == other); }
+
+private:
+	Delegate(const void* object, thunk_type thunk) : context_(), thunk_(object ? thunk : nullptr)
+	{
+		context_.object = const_cast<void*>(object);
+	}
+
+	static R function_thunk(const Context& context, Args&& ... args)
+	{
+		return (*context.function)(std_forward<Args>(args) ...);
+	}
+
+	template <class F>
+	static R object_thunk(const Context& context, Args&& ... args)
+	{
+		return (*static_cast<F*>(context.object))(std_forward<Args>(args) ...);
+	}
+
+	template <class Obj, R(Obj::*Method)(Args ...)>
+	static R method_thunk(const Context& context, Args&& ... args)
+	{
+		return (static_cast<Obj*>(context.object)->*Method)(std_forward<Args>(args) ...);
+	}
+
+	template <class Obj, R(Obj::*Method)(Args ...) const>
+	static R const_method_thunk(const Context& context, Args&& ... args)
+	{
+		return (static_cast<const Obj*>(context.object)->*Method)(std_forward<Args>(args) ...);
+	}
+
+	template <class Obj, R(*Function)(Obj&, Args ...)>
+	static R object_function_thunk(const Context& context, Args&& ... args)
+	{
+		return Function(*static_cast<Obj*>(context.object), std_forward<Args>(args) ...);
+	}
+
+private:
+	Context		context_;	// The delegate target.
+	thunk_type	thunk_;		// Calls the target, or null if empty.
+};
+
+template <class R, class ... Args>
+bool Delegate<R(Args ...)>::operator==(const Delegate& other) const
+{
+	if (thunk_ != other.thunk_)
+		return false;
+	else if (thunk_ == &function_thunk)
+		return context_.function == other.context_.function;
+	else
+		return context_.object == other.context_.object;
+}
+
+#endif // !defined DELEGATE_H__
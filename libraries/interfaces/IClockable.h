@@ -46,10 +46,25 @@
  *	thus making it useful when, for instance, not all tasks are of type 
  *	`IClockable' and use different execution methods.
  * 
+ *	The `clockDelegate()' function returns a `Delegate' (see <Delegate.h>) 
+ *	that calls an `IClockable' object's `clock()' method. It serves the same 
+ *	purpose as `ClockCommand' without requiring a separate command object. 
+ *	The method is called through the static type of the object passed, so 
+ *	the call is direct if that type is declared `final', and is dispatched 
+ *	through the vtable otherwise. Types that implement `clock()' privately 
+ *	must befriend `clockReceiver()', or be passed as `IClockable&'. The 
+ *	library's components befriend it but aren't `final', so that sketches 
+ *	can derive from them. A sketch opts in to direct calls by clocking a 
+ *	`final' type derived from a component instead: 
+ * 
+ *	struct FastDisplay final : Display { using Display::Display; };
+ * 
  *	Examples:
  * 
- *	class Clockable : public IClockable
+ *	class Clockable final : public IClockable
  *	{
+ *		template <class T> 
+ *		friend void clockReceiver(T&);
  *	public:
  *		...
  *	private:
@@ -61,6 +76,10 @@
  *	ClockCommand command(object);
  * 
  *	command.execute(); // Calls object.clock();
+ * 
+ *	Delegate<void()> delegate = clockDelegate(object);
+ * 
+ *	delegate(); // Calls Clockable::clock() directly.
  *****************************************************************************/
 
 
@@ -68,6 +87,7 @@
 # define ICLOCKABLE_H__ 20210409L
 
 #include "ICommand.h" // `ICommand' interface class.
+#include "Delegate.h" // `Delegate' type.
 
 // Abstract interface class for clockable types.
 struct IClockable
@@ -90,4 +110,18 @@ private:
 	IClockable& receiver_;
 };
 
+// Calls the `clock()' method of an IClockable object through its static type `T'.
+template <class T>
+inline void clockReceiver(T& receiver)
+{
+	receiver.clock();
+}
+
+// Returns a delegate that calls the `clock()' method of an IClockable object.
+template <class T>
+inline Delegate<void()> clockDelegate(T& receiver)
+{
+	return Delegate<void()>::bind<T, &clockReceiver<T>>(&receiver);
+}
+
 #endif // !defined ICLOCKABLE_H__ 
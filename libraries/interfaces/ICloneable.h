@@ -26,17 +26,77 @@
  *  You should have received a copy of the GNU General Public License
  *	along with this file. If not, see <http://www.gnu.org/licenses/>.
  *
+ *	**************************************************************************
+ *
+ *	Description:
+ *
+ *	The `ICloneable' interface declares methods that create a new object of 
+ *	the implementing type, either default constructed (`create()') or copy 
+ *	constructed from `*this' (`clone()'), without the client knowing the 
+ *	object's type. `clone()' and `create()' allocate the object on the heap. 
+ *	`clone_into()' and `create_into()' instead construct it in client-supplied 
+ *	storage, such as a block from an arena or object pool, and return a null 
+ *	pointer if the storage is too small or misaligned. `clone_size()' and 
+ *	`clone_align()' return the size and alignment the storage needs.
+ *
+ *	The `Cloneable' class template implements the whole interface for a 
+ *	derived type `Derived', using its default and copy constructors. `Base' 
+ *	is the interface the derived type implements, which must itself derive 
+ *	from `ICloneable', such as `ISerialCommand' (see <ICommand.h>):
+ *
+ *		class Move : public Cloneable<Move, ISerialCommand> { ... };
+ *
+ *		char buf[sizeof(Move)];
+ *		ICloneable* copy = move.clone_into(buf, sizeof(buf));
+ *
+ *	Objects constructed in client-supplied storage must be destroyed by the 
+ *	client, by calling their destructor, before the storage is reused.
+ *
  *	**************************************************************************/
 
 #if !defined ICLONEABLE_H__
 #define ICLONEABLE_H__ 20210717L
 
+#include <stddef.h>				// `size_t' type.
+#include <stdint.h>				// `uintptr_t' type.
+#include "uninitialized.h"		// `std_construct_at()'.
+
 struct ICloneable
 {
     virtual ~ICloneable() = default;
 
     virtual ICloneable* clone() const = 0;  // Uses the copy constructor
     virtual ICloneable* create() const = 0; // Uses the default constructor
+    virtual ICloneable* clone_into(void*, size_t) const = 0;    // Uses the copy constructor, in place
+    virtual ICloneable* create_into(void*, size_t) const = 0;   // Uses the default constructor, in place
+    virtual size_t clone_size() const = 0;  // Storage size `clone_into()' needs
+    virtual size_t clone_align() const = 0; // Storage alignment `clone_into()' needs
+};
+
+// Implements the `ICloneable' interface for type `Derived'.
+template <class Derived, class Base = ICloneable>
+struct Cloneable : public Base
+{
+    ICloneable* clone() const override { return new Derived(self()); }
+    ICloneable* create() const override { return new Derived(); }
+    ICloneable* clone_into(void* buf, size_t size) const override 
+    { 
+        return fits(buf, size) ? std_construct_at(static_cast<Derived*>(buf), self()) : nullptr; 
+    }
+    ICloneable* create_into(void* buf, size_t size) const override 
+    { 
+        return fits(buf, size) ? std_construct_at(static_cast<Derived*>(buf)) : nullptr; 
+    }
+    size_t clone_size() const override { return sizeof(Derived); }
+    size_t clone_align() const override { return alignof(Derived); }
+
+private:
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+    // Checks whether `size' bytes at `buf' can hold a `Derived'.
+    static bool fits(void* buf, size_t size)
+    {
+        return buf && size >= sizeof(Derived) && reinterpret_cast<uintptr_t>(buf) % alignof(Derived) == 0;
+    }
 };
 
 #endif // !defined ICLONEABLE_H__
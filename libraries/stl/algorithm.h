@@ -57,6 +57,266 @@
 #include "functional.h"	// STL compare functions.
 #include "utility.h"	// `std_pair', `std_make_pair', `std_move'
 #include "iterator.h"	// `std_iterator_traits' and related types.
+#include "type_traits.h"	// Type traits used to select bulk memory operations.
+#include <string.h>	// `memmove()', `memset()', `memcmp()'.
+#if defined __AVX2__
+# include <immintrin.h>	// AVX2 intrinsics.
+#elif defined __SSE2__
+# include <emmintrin.h>	// SSE2 intrinsics.
+#endif
+
+#pragma region simd_kernels
+
+// On x86 targets, searches and comparisons of contiguous integral ranges are 
+// vectorized with SSE2 and, if enabled at compile time (e.g. -mavx2), AVX2 
+// instructions. Other targets, including AVR, use the generic templates.
+
+namespace
+{
+	// Contiguous ranges of integral or pointer objects of the same type, which 
+	// are equal only if their representations are, are compared with `memcmp()'.
+	template<class T, class U>
+	struct std_is_memcmpable : public std_integral_constant<bool,
+		std_is_same<typename std_remove_const<T>::type, typename std_remove_const<U>::type>::value &&
+		(std_is_integral<typename std_remove_const<T>::type>::value || std_is_pointer<T>::value)> {};
+
+	// Contiguous ranges of 1, 2 and 4-byte integral objects are searched for 
+	// integral values with the SIMD kernels.
+	template<class T, class U>
+	struct std_is_simd_searchable : public std_integral_constant<bool,
+#if defined __SSE2__
+		std_is_integral<typename std_remove_const<T>::type>::value && 
+		(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4) &&
+		std_is_integral<typename std_remove_cv<U>::type>::value
+#else
+		false
+#endif
+		> {};
+
+	// Contiguous ranges that can be compared with `memcmp()' are compared with 
+	// the SIMD kernels.
+	template<class T, class U>
+	struct std_is_simd_comparable : public std_integral_constant<bool,
+#if defined __SSE2__
+		std_is_memcmpable<T, U>::value
+#else
+		false
+#endif
+		> {};
+
+#if defined __SSE2__
+	// 128-bit vector operations.
+	struct std_sse2
+	{
+		typedef __m128i type;
+		static const size_t Bytes = 16;
+		static const unsigned AllEqual = 0xFFFFU;
+
+		static type load(const void* p) { return _mm_loadu_si128(static_cast<const type*>(p)); }
+		static unsigned movemask(type v) { return static_cast<unsigned>(_mm_movemask_epi8(v)); }
+		static type set1(int8_t v) { return _mm_set1_epi8(v); }
+		static type set1(int16_t v) { return _mm_set1_epi16(v); }
+		static type set1(int32_t v) { return _mm_set1_epi32(v); }
+		static type cmpeq(type a, type b, int8_t) { return _mm_cmpeq_epi8(a, b); }
+		static type cmpeq(type a, type b, int16_t) { return _mm_cmpeq_epi16(a, b); }
+		static type cmpeq(type a, type b, int32_t) { return _mm_cmpeq_epi32(a, b); }
+	};
+
+# if defined __AVX2__
+	// 256-bit vector operations.
+	struct std_avx2
+	{
+		typedef __m256i type;
+		static const size_t Bytes = 32;
+		static const unsigned AllEqual = 0xFFFFFFFFU;
+
+		static type load(const void* p) { return _mm256_loadu_si256(static_cast<const type*>(p)); }
+		static unsigned movemask(type v) { return static_cast<unsigned>(_mm256_movemask_epi8(v)); }
+		static type set1(int8_t v) { return _mm256_set1_epi8(v); }
+		static type set1(int16_t v) { return _mm256_set1_epi16(v); }
+		static type set1(int32_t v) { return _mm256_set1_epi32(v); }
+		static type cmpeq(type a, type b, int8_t) { return _mm256_cmpeq_epi8(a, b); }
+		static type cmpeq(type a, type b, int16_t) { return _mm256_cmpeq_epi16(a, b); }
+		static type cmpeq(type a, type b, int32_t) { return _mm256_cmpeq_epi32(a, b); }
+	};
+# endif
+
+	// Signed integer type of the same size as `T', used to select the lane width.
+	template<class T>
+	struct std_simd_lane 
+	{ 
+		typedef typename std_conditional<sizeof(T) == 1, int8_t, 
+			typename std_conditional<sizeof(T) == 2, int16_t, int32_t>::type>::type type;
+	};
+
+	// Advances `first' over whole vectors not containing `value'; returns `true' 
+	// and sets `first' to the first match if found.
+	template<class Vec, class T>
+	bool std_simd_find_blocks(const T*& first, const T* last, T value)
+	{
+		typedef typename std_simd_lane<T>::type lane;
+		const typename Vec::type v = Vec::set1(static_cast<lane>(value));
+		const size_t Lanes = Vec::Bytes / sizeof(T);
+
+		for (; static_cast<size_t>(last - first) >= Lanes; first += Lanes)
+		{
+			unsigned mask = Vec::movemask(Vec::cmpeq(Vec::load(first), v, lane()));
+
+			if (mask)
+			{
+				first += __builtin_ctz(mask) / sizeof(T);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Advances `first' over whole vectors and returns the number of elements 
+	// equal to `value'.
+	template<class Vec, class T>
+	size_t std_simd_count_blocks(const T*& first, const T* last, T value)
+	{
+		typedef typename std_simd_lane<T>::type lane;
+		const typename Vec::type v = Vec::set1(static_cast<lane>(value));
+		const size_t Lanes = Vec::Bytes / sizeof(T);
+		size_t n = 0;
+
+		for (; static_cast<size_t>(last - first) >= Lanes; first += Lanes)
+			n += __builtin_popcount(Vec::movemask(Vec::cmpeq(Vec::load(first), v, lane())));
+		return n / sizeof(T);
+	}
+
+	// Advances `first1' and `first2' over whole vectors that are equal; returns 
+	// `true' and sets them to the first mismatch if found.
+	template<class Vec, class T>
+	bool std_simd_mismatch_blocks(const T*& first1, const T* last1, const T*& first2)
+	{
+		const size_t Lanes = Vec::Bytes / sizeof(T);
+
+		for (; static_cast<size_t>(last1 - first1) >= Lanes; first1 += Lanes, first2 += Lanes)
+		{
+			unsigned mask = Vec::movemask(Vec::cmpeq(Vec::load(first1), Vec::load(first2), int8_t()));
+
+			if (mask != Vec::AllEqual)
+			{
+				size_t n = __builtin_ctz(~mask) / sizeof(T);
+
+				first1 += n;
+				first2 += n;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template<class T>
+	const T* std_simd_find(const T* first, const T* last, T value)
+	{
+# if defined __AVX2__
+		if (std_simd_find_blocks<std_avx2>(first, last, value))
+			return first;
+# endif
+		if (std_simd_find_blocks<std_sse2>(first, last, value))
+			return first;
+		for (; first != last; ++first)
+			if (*first == value)
+				break;
+		return first;
+	}
+
+	template<class T>
+	size_t std_simd_count(const T* first, const T* last, T value)
+	{
+		size_t n = 0;
+
+# if defined __AVX2__
+		n += std_simd_count_blocks<std_avx2>(first, last, value);
+# endif
+		n += std_simd_count_blocks<std_sse2>(first, last, value);
+		for (; first != last; ++first)
+			if (*first == value)
+				++n;
+		return n;
+	}
+
+	template<class T>
+	const T* std_simd_mismatch(const T* first1, const T* last1, const T* first2)
+	{
+		const T* it = first1;
+
+# if defined __AVX2__
+		if (std_simd_mismatch_blocks<std_avx2>(it, last1, first2))
+			return it;
+# endif
+		if (std_simd_mismatch_blocks<std_sse2>(it, last1, first2))
+			return it;
+		for (; it != last1; ++it, ++first2)
+			if (!(*it == *first2))
+				break;
+		return it;
+	}
+
+	template<class T, class U>
+	T* std_find_contiguous(T* first, T* last, const U& value, std_true_type)
+	{
+		typedef typename std_remove_const<T>::type value_type;
+
+		// A value that `T' can't represent can't be equal to any element.
+		if (static_cast<U>(static_cast<value_type>(value)) != value)
+			return last;
+		return first + (std_simd_find<value_type>(first, last, static_cast<value_type>(value)) - first);
+	}
+
+	template<class T, class U>
+	ptrdiff_t std_count_contiguous(T* first, T* last, const U& value, std_true_type)
+	{
+		typedef typename std_remove_const<T>::type value_type;
+
+		if (static_cast<U>(static_cast<value_type>(value)) != value)
+			return 0;
+		return std_simd_count<value_type>(first, last, static_cast<value_type>(value));
+	}
+
+	template<class T, class U>
+	std_pair<T*, U*> std_mismatch_contiguous(T* first1, T* last1, U* first2, std_true_type)
+	{
+		typedef typename std_remove_const<T>::type value_type;
+		ptrdiff_t n = std_simd_mismatch<value_type>(first1, last1, first2) - first1;
+
+		return std_pair<T*, U*>(first1 + n, first2 + n);
+	}
+#endif // defined __SSE2__
+
+	template<class T, class U>
+	T* std_find_contiguous(T* first, T* last, const U& value, std_false_type)
+	{
+		for (; first != last; ++first)
+			if (*first == value)
+				break;
+		return first;
+	}
+
+	template<class T, class U>
+	ptrdiff_t std_count_contiguous(T* first, T* last, const U& value, std_false_type)
+	{
+		ptrdiff_t n = 0;
+
+		for (; first != last; ++first)
+			if (*first == value)
+				++n;
+		return n;
+	}
+
+	template<class T, class U>
+	std_pair<T*, U*> std_mismatch_contiguous(T* first1, T* last1, U* first2, std_false_type)
+	{
+		while (first1 != last1 && *first1 == *first2)
+			++first1, ++first2;
+		return std_pair<T*, U*>(first1, first2);
+	}
+} // namespace
+
+#pragma endregion
 
 #pragma region non-modifying_sequence_operations
 
@@ -82,6 +342,14 @@ template<class InputIt, class T>
 	return n;
 }
 
+// Counts the elements of a contiguous range equal to `value', using SIMD 
+// instructions if available.
+template<class T, class U>
+ptrdiff_t std_count(T* first, T* last, const U& value)
+{
+	return std_count_contiguous(first, last, value, std_is_simd_searchable<T, U>());
+}
+
 template< class InputIt, class UnaryPredicate >
 	typename std_iterator_traits<InputIt>::difference_type
 		std_count_if(InputIt first, InputIt last, UnaryPredicate p)
@@ -105,6 +373,14 @@ template<class InputIt1, class InputIt2>
 	}
 	return std_make_pair(first1, first2);
 }
+
+// Finds the first mismatch of two contiguous ranges, using SIMD instructions 
+// if available.
+template<class T, class U>
+std_pair<T*, U*> std_mismatch(T* first1, T* last1, U* first2)
+{
+	return std_mismatch_contiguous(first1, last1, first2, std_is_simd_comparable<T, U>());
+}
 	
 template<class InputIt1, class InputIt2, class BinaryPredicate>
 	std_pair<InputIt1, InputIt2>
@@ -141,6 +417,14 @@ InputIt std_find(InputIt first, InputIt last, const T& value)
 	return it;
 }
 
+// Finds the first element of a contiguous range equal to `value', using SIMD 
+// instructions if available.
+template<class T, class U>
+T* std_find(T* first, T* last, const U& value)
+{
+	return std_find_contiguous(first, last, value, std_is_simd_searchable<T, U>());
+}
+
 template<class InputIt, class UnaryPredicate>
 InputIt std_find_if(InputIt first, InputIt last, UnaryPredicate p)
 {
@@ -417,12 +701,86 @@ OutputIt std_copy(InputIt first, InputIt last, OutputIt dest)
 	return dest;
 }
 
+namespace
+{
+	// Contiguous ranges of trivially copyable objects of the same type are 
+	// copied and moved with `memmove()'.
+	template<class T, class U>
+	struct std_is_memmovable : public std_integral_constant<bool,
+		std_is_same<typename std_remove_const<T>::type, U>::value && std_is_trivially_copyable<U>::value> {};
+
+	// Contiguous ranges of single-byte integral objects are filled with `memset()'.
+	template<class T>
+	struct std_is_memsettable : public std_integral_constant<bool,
+		sizeof(T) == 1 && std_is_integral<T>::value> {};
+
+	template<class T, class U>
+	U* std_copy_contiguous(T* first, T* last, U* dest, std_true_type)
+	{
+		size_t n = last - first;
+
+		if (n)
+			memmove(dest, first, n * sizeof(U));
+		return dest + n;
+	}
+
+	template<class T, class U>
+	U* std_copy_contiguous(T* first, T* last, U* dest, std_false_type)
+	{
+		while (first != last)
+			*dest++ = *first++;
+		return dest;
+	}
+
+	template<class T, class U>
+	U* std_copy_pointers(T* first, T* last, U* dest, std_true_type)
+	{	// Ranges of pointers copy the objects pointed to.
+		while (first != last)
+			*(*dest++) = *(*first++);
+		return dest;
+	}
+
+	template<class T, class U>
+	U* std_copy_pointers(T* first, T* last, U* dest, std_false_type)
+	{
+		return std_copy_contiguous(first, last, dest, std_is_memmovable<T, U>());
+	}
+
+	template<class T, class U>
+	U* std_move_contiguous(T* first, T* last, U* dest, std_true_type)
+	{
+		return std_copy_contiguous(first, last, dest, std_true_type());
+	}
+
+	template<class T, class U>
+	U* std_move_contiguous(T* first, T* last, U* dest, std_false_type)
+	{
+		while (first != last)
+			*dest++ = std_move(*first++);
+		return dest;
+	}
+
+	template<class T, class U>
+	void std_fill_contiguous(T* first, T* last, const U& value, std_true_type)
+	{
+		if (first != last)
+			memset(first, static_cast<unsigned char>(static_cast<T>(value)), last - first);
+	}
+
+	template<class T, class U>
+	void std_fill_contiguous(T* first, T* last, const U& value, std_false_type)
+	{
+		while (first != last)
+			*first++ = value;
+	}
+} // namespace
+
+// Copies the objects pointed to by a range of pointers, otherwise copies the 
+// range, using `memmove()' if the elements are trivially copyable.
 template<class InputIt, class OutputIt>
 OutputIt* std_copy(InputIt* first, InputIt* last, OutputIt* dest)
 {
-	while (first != last)
-		*(*dest++) = *(*first++);
-	return dest;
+	return std_copy_pointers(first, last, dest, std_is_pointer<InputIt>());
 }
 
 template< class InputIt, class OutputIt, class UnaryPredicate >
@@ -470,6 +828,13 @@ OutputIt std_move(InputIt first, InputIt last, OutputIt dest)
 	return dest;
 }
 
+// Moves a contiguous range, using `memmove()' if the elements are trivially copyable.
+template<class T, class U>
+U* std_move(T* first, T* last, U* dest)
+{
+	return std_move_contiguous(first, last, dest, std_is_memmovable<T, U>());
+}
+
 template<class BidirIt1, class BidirIt2>
 BidirIt2 std_move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 dest)
 {
@@ -484,6 +849,13 @@ void std_fill(ForwardIt first, ForwardIt last, const T& value)
 		*first++ = value;
 }
 
+// Fills a contiguous range, using `memset()' if the elements are single bytes.
+template<class T, class U>
+void std_fill(T* first, T* last, const U& value)
+{
+	std_fill_contiguous(first, last, value, std_is_memsettable<T>());
+}
+
 template<class OutputIt, class Size, class T>
 OutputIt std_fill_n(OutputIt first, Size count, const T& value)
 {
@@ -993,6 +1365,105 @@ bool std_is_heap(RandomIt first, RandomIt last, RandomIt root)
 	return result;
 }
 
+namespace
+{
+	// Moves the element at `hole' down the heap [first, first + len) until 
+	// neither child compares greater.
+	template<class RandomIt, class Distance, class Compare>
+	void std_sift_down(RandomIt first, Distance len, Distance hole, Compare comp)
+	{
+		typename std_iterator_traits<RandomIt>::value_type value = std_move(*(first + hole));
+		Distance child;
+
+		while ((child = 2 * hole + 1) < len)
+		{
+			if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
+				++child;
+			if (!comp(value, *(first + child)))
+				break;
+			*(first + hole) = std_move(*(first + child));
+			hole = child;
+		}
+		*(first + hole) = std_move(value);
+	}
+
+	// Moves the element at `hole' up the heap at `first' until its parent 
+	// doesn't compare less.
+	template<class RandomIt, class Distance, class Compare>
+	void std_sift_up(RandomIt first, Distance hole, Compare comp)
+	{
+		typename std_iterator_traits<RandomIt>::value_type value = std_move(*(first + hole));
+		Distance parent;
+
+		while (hole > 0 && comp(*(first + (parent = (hole - 1) / 2)), value))
+		{
+			*(first + hole) = std_move(*(first + parent));
+			hole = parent;
+		}
+		*(first + hole) = std_move(value);
+	}
+} // namespace
+
+// Arranges the range [first, last) into a heap ordered by `comp'.
+template<class RandomIt, class Compare>
+void std_make_heap(RandomIt first, RandomIt last, Compare comp)
+{
+	typename std_iterator_traits<RandomIt>::difference_type len = last - first, i = len / 2;
+
+	while (i-- > 0)
+		std_sift_down(first, len, i, comp);
+}
+
+// Inserts the element at `last - 1' into the heap [first, last - 1).
+template<class RandomIt, class Compare>
+void std_push_heap(RandomIt first, RandomIt last, Compare comp)
+{
+	typename std_iterator_traits<RandomIt>::difference_type len = last - first;
+
+	if (len > 1)
+		std_sift_up(first, len - 1, comp);
+}
+
+template<class RandomIt>
+void std_push_heap(RandomIt first, RandomIt last)
+{
+	std_push_heap(first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+// Moves the greatest element of the heap [first, last) to `last - 1' and 
+// makes [first, last - 1) a heap.
+template<class RandomIt, class Compare>
+void std_pop_heap(RandomIt first, RandomIt last, Compare comp)
+{
+	typename std_iterator_traits<RandomIt>::difference_type len = last - first;
+
+	if (len > 1)
+	{
+		std_iter_swap(first, last - 1);
+		std_sift_down(first, len - 1, decltype(len)(0), comp);
+	}
+}
+
+template<class RandomIt>
+void std_pop_heap(RandomIt first, RandomIt last)
+{
+	std_pop_heap(first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+// Sorts the heap [first, last) into ascending order with respect to `comp'.
+template<class RandomIt, class Compare>
+void std_sort_heap(RandomIt first, RandomIt last, Compare comp)
+{
+	for (; last - first > 1; --last)
+		std_pop_heap(first, last, comp);
+}
+
+template<class RandomIt>
+void std_sort_heap(RandomIt first, RandomIt last)
+{
+	std_sort_heap(first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
 // Default sort algorithm is Insertion Sort.
 template <class RandomIt>
 void std_sort(RandomIt first, RandomIt last)
@@ -1043,96 +1514,292 @@ void std_sort(RandomIt first, RandomIt last, std_quick_sort_tag)
 	}
 }
 
-#pragma endregion
-
-#pragma region binary_search_operations
-
-template <class ForwardIt, class T>
-ForwardIt std_lower_bound(ForwardIt first, ForwardIt last, const T& val)
+namespace
 {
-	ForwardIt it;
-	typename std_iterator_traits<ForwardIt>::difference_type count, step;
-	count = std_distance(first, last);
-	while (count > 0)
+	// Number of elements in each insertion-sorted run of `std_stable_sort'.
+	const ptrdiff_t StableSortRunLength = 16;
+
+	// Stable insertion sort of [first, last) using `comp'.
+	template <class RandomIt, class Compare>
+	void std_insertion_sort(RandomIt first, RandomIt last, Compare comp)
 	{
-		it = first; 
-		step = count / 2; 
-		std_advance(it, step);
-		if (*it < val) 
+		if (first == last)
+			return;
+		for (RandomIt i = first + 1; i < last; ++i)
 		{
-			first = ++it;
-			count -= step + 1;
+			typename std_iterator_traits<RandomIt>::value_type tmp = std_move(*i);
+			RandomIt j = i;
+
+			for (; j > first && comp(tmp, *(j - 1)); --j)
+				*j = std_move(*(j - 1));
+			*j = std_move(tmp);
 		}
-		else 
-			count = step;
 	}
-	return first;
-}
 
-template<class ForwardIt, class T, class Compare>
-ForwardIt std_lower_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp)
-{
-	ForwardIt it;
-	typename std_iterator_traits<ForwardIt>::difference_type count, step;
-	count = std_distance(first, last);
+	// Merges [first, middle) and [middle, last) through scratch buffer `buf',
+	// which must hold at least the smaller of the two ranges.
+	template <class RandomIt, class T, class Compare>
+	void std_merge_buffered(RandomIt first, RandomIt middle, RandomIt last, T* buf, Compare comp)
+	{
+		if (middle - first <= last - middle)
+		{
+			// Move the left range out and merge forwards.
+			T* buf_last = std_move(first, middle, buf);
+			T* b = buf;
+
+			while (b != buf_last && middle != last)
+				*first++ = comp(*middle, *b) ? std_move(*middle++) : std_move(*b++);
+			std_move(b, buf_last, first);
+		}
+		else
+		{
+			// Move the right range out and merge backwards.
+			T* buf_last = std_move(middle, last, buf);
+
+			while (buf != buf_last && first != middle)
+				*--last = comp(*(buf_last - 1), *(middle - 1)) ? std_move(*--middle) : std_move(*--buf_last);
+			std_move_backward(buf, buf_last, last);
+		}
+	}
 
-	while (count > 0) 
+	// Merges [first, middle) and [middle, last), using scratch buffer `buf'
+	// of `buf_size' elements whenever a subproblem fits in it and otherwise
+	// splitting with the SymMerge rotation algorithm (Kim & Kutzner, 2004),
+	// which needs O(m log(n/m + 1)) comparisons and no extra memory.
+	template <class RandomIt, class T, class Compare>
+	void std_merge_adaptive(RandomIt first, RandomIt middle, RandomIt last, T* buf, ptrdiff_t buf_size, Compare comp)
 	{
-		it = first;
-		step = count / 2;
-		std_advance(it, step);
-		if (comp(*it, value)) 
+		const ptrdiff_t len1 = middle - first, len2 = last - middle;
+
+		if (len1 == 0 || len2 == 0 || !comp(*middle, *(middle - 1)))
+			return; // Nothing to do, ranges are already in order.
+		if (len1 <= buf_size || len2 <= buf_size)
 		{
-			first = ++it;
-			count -= step + 1;
+			std_merge_buffered(first, middle, last, buf, comp);
+			return;
 		}
+
+		const ptrdiff_t half = (len1 + len2) / 2, n = len1 + half;
+		ptrdiff_t start, r;
+
+		if (len1 > half)
+			start = n - (len1 + len2), r = half;
 		else
-			count = step;
+			start = 0, r = len1;
+
+		// Binary search for the symmetric split point about `middle'.
+		const ptrdiff_t p = n - 1;
+		while (start < r)
+		{
+			ptrdiff_t c = (start + r) / 2;
+			if (!comp(*(first + (p - c)), *(first + c)))
+				start = c + 1;
+			else
+				r = c;
+		}
+
+		const ptrdiff_t end = n - start;
+		if (start < len1 && len1 < end)
+			std_rotate(first + start, middle, first + end);
+		if (0 < start && start < half)
+			std_merge_adaptive(first, first + start, first + half, buf, buf_size, comp);
+		if (half < end && end < len1 + len2)
+			std_merge_adaptive(first + half, first + end, last, buf, buf_size, comp);
 	}
-	return first;
-}
 
-template <class ForwardIt, class T>
-ForwardIt std_upper_bound(ForwardIt first, ForwardIt last, const T& val)
-{
-	ForwardIt it;
-	typename std_iterator_traits<ForwardIt>::difference_type count, step;
-	count = std_distance(first, last);
-	while (count > 0)
+	template <class RandomIt, class T, class Compare>
+	void std_stable_sort_impl(RandomIt first, RandomIt last, T* buf, ptrdiff_t buf_size, Compare comp)
 	{
-		it = first; 
-		step = count / 2; 
-		std_advance(it, step);
-		if (!(val < *it))
-		{ 
-			first = ++it; 
-			count -= step + 1;  
+		const ptrdiff_t len = last - first;
+
+		// Sort short runs by insertion, then merge runs of doubling width.
+		for (ptrdiff_t i = 0; i < len; i += StableSortRunLength)
+			std_insertion_sort(first + i, first + (len - i < StableSortRunLength ? len : i + StableSortRunLength), comp);
+		for (ptrdiff_t width = StableSortRunLength; width < len; width *= 2)
+		{
+			for (ptrdiff_t i = 0; i < len - width; i += 2 * width)
+				std_merge_adaptive(first + i, first + i + width,
+					first + (len - i < 2 * width ? len : i + 2 * width), buf, buf_size, comp);
 		}
-		else count = step;
 	}
-	return first;
+} // namespace
+
+// Merges two consecutive sorted ranges [first, middle) and [middle, last) into
+// one sorted range, preserving the relative order of equivalent elements.
+// Requires no extra memory, O(n log n) comparisons and O(n log^2 n) moves.
+template <class RandomIt, class Compare>
+void std_inplace_merge(RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+{
+	std_merge_adaptive(first, middle, last,
+		static_cast<typename std_iterator_traits<RandomIt>::value_type*>(nullptr), 0, comp);
 }
 
-template<class ForwardIt, class T, class Compare>
-ForwardIt std_upper_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp)
+template <class RandomIt>
+void std_inplace_merge(RandomIt first, RandomIt middle, RandomIt last)
+{
+	std_inplace_merge(first, middle, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+// `std_inplace_merge()' overload that uses the client-supplied scratch buffer
+// `buf' of `buf_size' elements. A buffer at least as large as the smaller range
+// gives a linear merge, smaller buffers are used for the subproblems that fit.
+template <class RandomIt, class T, class Compare>
+void std_inplace_merge(RandomIt first, RandomIt middle, RandomIt last, T* buf, size_t buf_size, Compare comp)
+{
+	std_merge_adaptive(first, middle, last, buf, static_cast<ptrdiff_t>(buf_size), comp);
+}
+
+template <class RandomIt, class T>
+void std_inplace_merge(RandomIt first, RandomIt middle, RandomIt last, T* buf, size_t buf_size)
 {
-	ForwardIt it;
-	typename std_iterator_traits<ForwardIt>::difference_type count, step;
-	count = std_distance(first, last);
-	while (count > 0) 
+	std_inplace_merge(first, middle, last, buf, buf_size,
+		std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+// Sorts the range [first, last), preserving the relative order of equivalent
+// elements. Requires no extra memory, O(n log n) comparisons and O(n log^2 n)
+// moves. Not recursive except for the merge step, which is O(log n) deep.
+template <class RandomIt, class Compare>
+void std_stable_sort(RandomIt first, RandomIt last, Compare comp)
+{
+	std_stable_sort_impl(first, last,
+		static_cast<typename std_iterator_traits<RandomIt>::value_type*>(nullptr), 0, comp);
+}
+
+template <class RandomIt>
+void std_stable_sort(RandomIt first, RandomIt last)
+{
+	std_stable_sort(first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+// `std_stable_sort()' overload that uses the client-supplied scratch buffer
+// `buf' of `buf_size' elements. With a buffer of half the range size or more
+// all merges are linear, giving O(n log n) moves.
+template <class RandomIt, class T, class Compare>
+void std_stable_sort(RandomIt first, RandomIt last, T* buf, size_t buf_size, Compare comp)
+{
+	std_stable_sort_impl(first, last, buf, static_cast<ptrdiff_t>(buf_size), comp);
+}
+
+template <class RandomIt, class T>
+void std_stable_sort(RandomIt first, RandomIt last, T* buf, size_t buf_size)
+{
+	std_stable_sort(first, last, buf, buf_size,
+		std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+#pragma endregion
+
+#pragma region binary_search_operations
+
+namespace
+{
+	// Compares two objects of possibly different types with `operator<'.
+	struct std_less_than
+	{
+		template<class T, class U>
+		bool operator()(const T& lhs, const U& rhs) const { return lhs < rhs; }
+	};
+
+	// Returns the first element of a range for which `pred' is false, given that it's true for 
+	// every element before it. Forward iterators are bisected by advancing from the start.
+	template<class ForwardIt, class Pred>
+	ForwardIt std_partition_point_impl(ForwardIt first, ForwardIt last, Pred pred, std_forward_iterator_tag)
+	{
+		ForwardIt it;
+		typename std_iterator_traits<ForwardIt>::difference_type count, step;
+		count = std_distance(first, last);
+
+		while (count > 0) 
+		{
+			it = first;
+			step = count / 2;
+			std_advance(it, step);
+			if (pred(*it)) 
+			{
+				first = ++it;
+				count -= step + 1;
+			}
+			else
+				count = step;
+		}
+		return first;
+	}
+
+	// Random access ranges are bisected without branching on the comparison: each step keeps 
+	// either half by selecting its start, which compiles to a conditional move where the target 
+	// has one, so the loop runs exactly log2(n) times and never mispredicts. 
+	template<class RandomIt, class Pred>
+	RandomIt std_partition_point_impl(RandomIt first, RandomIt last, Pred pred, std_random_access_iterator_tag)
 	{
-		it = first;
-		step = count / 2;
-		std_advance(it, step);
-		if (!comp(value, *it)) 
+		typename std_iterator_traits<RandomIt>::difference_type n = last - first, half;
+
+		if (n == 0)
+			return first;
+		while (n > 1)
 		{
-			first = ++it;
-			count -= step + 1;
+			half = n / 2;
+			first = pred(first[half]) ? first + half : first;
+			n -= half;
 		}
-		else
-			count = step;
+		return first + pred(*first);
 	}
-	return first;
+
+	// Predicate that's true for elements less than `value'.
+	template<class T, class Compare>
+	struct std_lower_bound_pred
+	{
+		std_lower_bound_pred(const T& value, Compare comp) : value_(value), comp_(comp) {}
+		template<class U>
+		bool operator()(const U& x) const { return comp_(x, value_); }
+
+		const T&	value_;
+		Compare		comp_;
+	};
+
+	// Predicate that's true for elements not greater than `value'.
+	template<class T, class Compare>
+	struct std_upper_bound_pred
+	{
+		std_upper_bound_pred(const T& value, Compare comp) : value_(value), comp_(comp) {}
+		template<class U>
+		bool operator()(const U& x) const { return !comp_(value_, x); }
+
+		const T&	value_;
+		Compare		comp_;
+	};
+} // namespace
+
+template<class ForwardIt, class T, class Compare>
+ForwardIt std_lower_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp)
+{
+	return std_partition_point_impl(first, last, std_lower_bound_pred<T, Compare>(value, comp), 
+		typename std_iterator_traits<ForwardIt>::iterator_category());
+}
+
+template <class ForwardIt, class T>
+ForwardIt std_lower_bound(ForwardIt first, ForwardIt last, const T& val)
+{
+	return std_lower_bound(first, last, val, std_less_than());
+}
+
+template<class ForwardIt, class T, class Compare>
+ForwardIt std_upper_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp)
+{
+	return std_partition_point_impl(first, last, std_upper_bound_pred<T, Compare>(value, comp), 
+		typename std_iterator_traits<ForwardIt>::iterator_category());
+}
+
+template <class ForwardIt, class T>
+ForwardIt std_upper_bound(ForwardIt first, ForwardIt last, const T& val)
+{
+	return std_upper_bound(first, last, val, std_less_than());
+}
+
+template<class ForwardIt, class UnaryPredicate>
+ForwardIt std_partition_point(ForwardIt first, ForwardIt last, UnaryPredicate p)
+{
+	return std_partition_point_impl(first, last, p, typename std_iterator_traits<ForwardIt>::iterator_category());
 }
 
 template <class ForwardIt, class T>
@@ -1517,6 +2184,33 @@ bool std_equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
 	return first1 == last1;
 }
 
+namespace
+{
+	template<class T, class U>
+	bool std_equal_contiguous(T* first1, T* last1, U* first2, std_true_type)
+	{
+		return first1 == last1 || memcmp(first1, first2, (last1 - first1) * sizeof(T)) == 0;
+	}
+
+	template<class T, class U>
+	bool std_equal_contiguous(T* first1, T* last1, U* first2, std_false_type)
+	{
+		for (; first1 != last1; ++first1, ++first2)
+		{
+			if (!(*first1 == *first2))
+				return false;
+		}
+		return true;
+	}
+} // namespace
+
+// Compares two contiguous ranges, using `memcmp()' for integral and pointer elements.
+template<class T, class U>
+bool std_equal(T* first1, T* last1, U* first2)
+{
+	return std_equal_contiguous(first1, last1, first2, std_is_memcmpable<T, U>());
+}
+
 template<class InputIt1, class InputIt2, class BinaryPredicate>
 bool std_equal(InputIt1 first1, InputIt1 last1,	InputIt2 first2, BinaryPredicate p)
 {
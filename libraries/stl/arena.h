@@ -0,0 +1,191 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) style region
+ *	allocator over a static buffer.
+ *
+ *	***************************************************************************
+ *
+ *	File: arena.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_arena' and `std_arena_scope' classes,
+ *		which are not part of the Standard, though `std_arena' behaves much
+ *		like the C++17 `std::pmr::monotonic_buffer_resource'. An arena hands
+ *		out aligned blocks of a client-supplied buffer by bumping a pointer,
+ *		so allocation takes constant time and costs no bookkeeping memory.
+ *		Blocks are never freed one at a time. Instead, `mark()' records the
+ *		current position and `rewind()' releases everything allocated since.
+ *		A `std_arena_scope' does both automatically, which suits temporaries
+ *		that only live for the duration of a function call:
+ *
+ *			char scratch_buf[64];
+ *			std_arena scratch(scratch_buf);
+ *
+ *			void listEvents()
+ *			{
+ *				std_arena_scope scope(scratch);
+ *				char* line = scratch.allocate<char>(MaxCharsPerRecord);
+ *				...
+ *			}	// `line' is released here.
+ *
+ *		The arena keeps usage statistics: the largest number of bytes ever
+ *		in use (high-water mark), which helps size the buffer, and the
+ *		number of requests that failed because it was exhausted. A failed
+ *		request returns a null pointer.
+ *
+ *		The arena does not run destructors. Objects placed in it must either
+ *		be trivially destructible or be destroyed by the client before their
+ *		storage is rewound.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined ARENA_H__
+# define ARENA_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stddef.h>			// `size_t', `max_align_t'.
+# include <stdint.h>			// `uintptr_t'.
+
+# pragma region std_arena
+
+// Region allocator over a client-supplied buffer.
+class std_arena
+{
+public:		/**** Member Types and Constants ****/
+	typedef size_t size_type;
+	typedef size_type marker_type;	// Arena position returned by `mark()'.
+
+	static const size_type DefaultAlignment = alignof(max_align_t);
+
+public:		/**** Ctors ****/
+	template<size_t Size>
+	explicit std_arena(char (&buf)[Size]) : std_arena(buf, Size) {}
+	std_arena(char* buf, size_type size) :
+		buf_(buf), size_(size), used_(), high_water_(), failures_() {}
+	std_arena(const std_arena&) = delete;
+
+	std_arena& operator=(const std_arena&) = delete;
+
+public:		/**** Member Functions ****/
+	// Returns `n' bytes aligned on `align', which must be a power of two, or a null pointer if the arena is exhausted.
+	void*					allocate(size_type, size_type = DefaultAlignment);
+	// Returns uninitialized storage for `n' objects of type `T', or a null pointer if the arena is exhausted.
+	template<class T>
+	T*						allocate(size_type n = 1) { return static_cast<T*>(allocate(n * sizeof(T), alignof(T))); }
+	// Returns the current position, for a later `rewind()'.
+	marker_type				mark() const { return used_; }
+	// Releases everything allocated since `mark' was taken.
+	void					rewind(marker_type);
+	// Releases everything.
+	void					reset() { used_ = 0; }
+	// Checks whether `p' points into the arena's buffer.
+	bool					owns(const void*) const;
+	size_type				size() const { return used_; }
+	size_type				available() const { return size_ - used_; }
+	size_type				capacity() const { return size_; }
+	bool					empty() const { return used_ == 0; }
+	// Returns the largest number of bytes ever in use.
+	size_type				high_water() const { return high_water_; }
+	// Returns the number of allocation requests that failed.
+	size_type				failures() const { return failures_; }
+	// Clears the failure count and restarts the high-water mark from the current use.
+	void					reset_stats() { high_water_ = used_; failures_ = 0; }
+
+private:	/**** Member Objects ****/
+	char*		buf_;			// Arena storage.
+	size_type	size_;			// Size of `buf_' in bytes.
+	size_type	used_;			// Number of bytes allocated, including alignment padding.
+	size_type	high_water_;	// Largest value of `used_'.
+	size_type	failures_;		// Number of failed allocations.
+};
+
+# pragma endregion
+
+# pragma region std_arena_scope
+
+// Releases everything allocated from an arena during its lifetime.
+class std_arena_scope
+{
+public:		/**** Ctors ****/
+	explicit std_arena_scope(std_arena& arena) : arena_(arena), mark_(arena.mark()) {}
+	std_arena_scope(const std_arena_scope&) = delete;
+	~std_arena_scope() { arena_.rewind(mark_); }
+
+	std_arena_scope& operator=(const std_arena_scope&) = delete;
+
+private:	/**** Member Objects ****/
+	std_arena&				arena_;	// The managed arena.
+	std_arena::marker_type	mark_;	// Arena position at construction.
+};
+
+# pragma endregion
+
+#pragma region std_arena_member_functions
+
+inline void* std_arena::allocate(size_type n, size_type align)
+{
+	assert(align != 0 && (align & (align - 1)) == 0);
+
+	// Align the absolute address, not the offset, since `buf_' may have any alignment.
+	const uintptr_t base = reinterpret_cast<uintptr_t>(buf_);
+	const uintptr_t first = (base + used_ + (align - 1)) & ~static_cast<uintptr_t>(align - 1);
+	const size_type offset = static_cast<size_type>(first - base);
+
+	if (offset > size_ || n > size_ - offset)
+	{
+		++failures_;
+		return nullptr;
+	}
+	used_ = offset + n;
+	if (used_ > high_water_)
+		high_water_ = used_;
+
+	return buf_ + offset;
+}
+
+inline void std_arena::rewind(marker_type mark)
+{
+	assert(mark <= used_);
+	if (mark < used_)
+		used_ = mark;
+}
+
+inline bool std_arena::owns(const void* p) const
+{
+	// Comparing unrelated pointers is unspecified, so test the range as integers.
+	const uintptr_t addr = reinterpret_cast<uintptr_t>(p), base = reinterpret_cast<uintptr_t>(buf_);
+
+	return addr >= base && addr < base + size_;
+}
+
+#pragma endregion
+
+#endif // !defined ARENA_H__
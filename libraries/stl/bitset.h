@@ -0,0 +1,475 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) fixed-size
+ *	sequence of bits.
+ *
+ *	***************************************************************************
+ *
+ *	File: bitset.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_bitset' type from the <bitset> header of
+ *		a C++ Standard Template Library (STL) implementation. The type
+ *		behaves according to the ISO C++11 Standard: (ISO/IEC 14882:2011),
+ *		except that it has no string conversions or stream operators.
+ *
+ *		Bits are packed into an array of machine words: bytes on AVR targets,
+ *		which have an 8-bit ALU, and `unsigned long' elsewhere. All bitwise
+ *		operations work a word at a time, `count()' uses the compiler's
+ *		population count and, as extensions, `find_first()' and `find_next()'
+ *		locate set bits with the count-trailing-zeros builtin, so scanning a
+ *		set takes time proportional to the number of words, not bits. The
+ *		`begin()' and `end()' extensions iterate over the positions of the
+ *		set bits:
+ *
+ *			std_bitset<16> ready;
+ *			...
+ *			for (size_t i : ready)
+ *				run(i);
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined BITSET_H__
+# define BITSET_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <limits.h>			// `CHAR_BIT'.
+# include <stddef.h>			// `size_t'.
+# include <stdint.h>			// Fixed-width integral types.
+# include "iterator.h"			// `std_forward_iterator_tag'.
+
+namespace
+{
+	// Returns the number of set bits in `w'.
+	inline unsigned std_popcount(unsigned char w) { return __builtin_popcount(w); }
+	inline unsigned std_popcount(unsigned int w) { return __builtin_popcount(w); }
+	inline unsigned std_popcount(unsigned long w) { return __builtin_popcountl(w); }
+
+	// Returns the number of trailing zero bits in `w', which must not be zero.
+	inline unsigned std_countr_zero(unsigned char w) { return __builtin_ctz(w); }
+	inline unsigned std_countr_zero(unsigned int w) { return __builtin_ctz(w); }
+	inline unsigned std_countr_zero(unsigned long w) { return __builtin_ctzl(w); }
+}
+
+# pragma region std_bitset
+
+// Fixed-size sequence of `N' bits.
+template<size_t N>
+class std_bitset
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_bitset<N> self_type;
+# if defined __AVR__
+	typedef uint8_t word_type;
+# else
+	typedef unsigned long word_type;
+# endif
+
+	static const size_t WordBits = sizeof(word_type) * CHAR_BIT;
+	static const size_t Words = N == 0 ? 1U : (N + WordBits - 1) / WordBits;
+
+	// Proxy for a single bit, returned by the non-const subscript operator.
+	class reference
+	{
+		friend class std_bitset;
+
+	public:
+		reference& operator=(bool x) { set_->set(pos_, x); return *this; }
+		reference& operator=(const reference& x) { return *this = bool(x); }
+		operator bool() const { return set_->test(pos_); }
+		bool operator~() const { return !set_->test(pos_); }
+		reference& flip() { set_->flip(pos_); return *this; }
+
+	private:
+		reference(std_bitset* set, size_t pos) : set_(set), pos_(pos) {}
+
+	private:
+		std_bitset*	set_;
+		size_t		pos_;
+	};
+
+	// Forward iterator over the positions of the set bits.
+	class const_iterator
+	{
+	public:
+		typedef std_forward_iterator_tag iterator_category;
+		typedef size_t value_type;
+		typedef ptrdiff_t difference_type;
+		typedef const size_t* pointer;
+		typedef size_t reference;
+
+	public:
+		const_iterator(const std_bitset* set, size_t pos) : set_(set), pos_(pos) {}
+
+	public:
+		size_t operator*() const { return pos_; }
+		const_iterator& operator++() { pos_ = set_->find_next(pos_); return *this; }
+		const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+		bool operator==(const const_iterator& other) const { return pos_ == other.pos_; }
+		bool operator!=(const const_iterator& other) const { return pos_ != other.pos_; }
+
+	private:
+		const std_bitset*	set_;
+		size_t				pos_;
+	};
+
+	typedef const_iterator iterator;
+
+public:		/**** Ctors ****/
+	std_bitset() : words_() {}
+	std_bitset(unsigned long long);
+
+public:		/**** Member Functions ****/
+	bool				operator[](size_t pos) const { return test(pos); }
+	reference			operator[](size_t pos) { return reference(this, pos); }
+	bool				test(size_t) const;
+	bool				all() const;
+	bool				any() const;
+	bool				none() const { return !any(); }
+	size_t				count() const;
+	static constexpr size_t size() { return N; }
+	self_type&			operator&=(const self_type&);
+	self_type&			operator|=(const self_type&);
+	self_type&			operator^=(const self_type&);
+	self_type			operator~() const { return self_type(*this).flip(); }
+	self_type			operator<<(size_t n) const { return self_type(*this) <<= n; }
+	self_type&			operator<<=(size_t);
+	self_type			operator>>(size_t n) const { return self_type(*this) >>= n; }
+	self_type&			operator>>=(size_t);
+	self_type&			set();
+	self_type&			set(size_t, bool = true);
+	self_type&			reset();
+	self_type&			reset(size_t pos) { return set(pos, false); }
+	self_type&			flip();
+	self_type&			flip(size_t);
+	unsigned long		to_ulong() const;
+	unsigned long long	to_ullong() const;
+	bool				operator==(const self_type&) const;
+	bool				operator!=(const self_type& other) const { return !(*this == other); }
+	// Returns the position of the first set bit, or `size()' if none.
+	size_t				find_first() const { return find_from(0, words_[0]); }
+	// Returns the position of the first set bit after `pos', or `size()' if none.
+	size_t				find_next(size_t) const;
+	const_iterator		begin() const { return const_iterator(this, find_first()); }
+	const_iterator		end() const { return const_iterator(this, N); }
+	// Returns a pointer to the underlying words, least significant first.
+	const word_type*	data() const { return words_; }
+
+private:
+	// Returns the mask of the bit at `pos' within its word.
+	static word_type	mask(size_t pos) { return static_cast<word_type>(1) << (pos % WordBits); }
+	// Returns the first set bit in word `i' or later, with `w' the masked word `i'.
+	size_t				find_from(size_t, word_type) const;
+	// Clears the unused bits of the last word.
+	void				trim();
+
+private:	/**** Member Objects ****/
+	static const word_type LastMask = N == 0 ? 0 : N % WordBits == 0 ? static_cast<word_type>(~word_type()) :
+		static_cast<word_type>((static_cast<word_type>(1) << (N % WordBits)) - 1);
+
+	word_type	words_[Words];	// Bit storage, least significant word first.
+};
+
+# pragma endregion
+
+#pragma region std_bitset_ctors
+
+template<size_t N>
+std_bitset<N>::std_bitset(unsigned long long value) : words_()
+{
+	for (size_t i = 0; i < Words && value; ++i)
+	{
+		words_[i] = static_cast<word_type>(value);
+		value = sizeof(value) > sizeof(word_type) ? value >> (WordBits % (sizeof(value) * CHAR_BIT)) : 0;
+	}
+	trim();
+}
+
+#pragma endregion
+
+#pragma region std_bitset_member_functions
+
+template<size_t N>
+bool std_bitset<N>::test(size_t pos) const
+{
+	assert(pos < N);
+
+	return (words_[pos / WordBits] & mask(pos)) != 0;
+}
+
+template<size_t N>
+bool std_bitset<N>::all() const
+{
+	for (size_t i = 0; i < Words - 1; ++i)
+		if (words_[i] != static_cast<word_type>(~word_type()))
+			return false;
+
+	return words_[Words - 1] == LastMask;
+}
+
+template<size_t N>
+bool std_bitset<N>::any() const
+{
+	for (size_t i = 0; i < Words; ++i)
+		if (words_[i])
+			return true;
+
+	return false;
+}
+
+template<size_t N>
+size_t std_bitset<N>::count() const
+{
+	size_t n = 0;
+
+	for (size_t i = 0; i < Words; ++i)
+		n += std_popcount(words_[i]);
+
+	return n;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::operator&=(const self_type& other)
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] &= other.words_[i];
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::operator|=(const self_type& other)
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] |= other.words_[i];
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::operator^=(const self_type& other)
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] ^= other.words_[i];
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::operator<<=(size_t n)
+{
+	const size_t shift = n / WordBits, offset = n % WordBits;
+
+	if (n >= N)
+		return reset();
+	if (offset == 0)
+	{
+		for (size_t i = Words - 1; i >= shift && i < Words; --i)
+			words_[i] = words_[i - shift];
+	}
+	else
+	{
+		for (size_t i = Words - 1; i > shift; --i)
+			words_[i] = static_cast<word_type>((words_[i - shift] << offset) |
+				(words_[i - shift - 1] >> (WordBits - offset)));
+		words_[shift] = static_cast<word_type>(words_[0] << offset);
+	}
+	for (size_t i = 0; i < shift; ++i)
+		words_[i] = 0;
+	trim();
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::operator>>=(size_t n)
+{
+	const size_t shift = n / WordBits, offset = n % WordBits, last = Words - shift - 1;
+
+	if (n >= N)
+		return reset();
+	if (offset == 0)
+	{
+		for (size_t i = 0; i <= last; ++i)
+			words_[i] = words_[i + shift];
+	}
+	else
+	{
+		for (size_t i = 0; i < last; ++i)
+			words_[i] = static_cast<word_type>((words_[i + shift] >> offset) |
+				(words_[i + shift + 1] << (WordBits - offset)));
+		words_[last] = static_cast<word_type>(words_[Words - 1] >> offset);
+	}
+	for (size_t i = last + 1; i < Words; ++i)
+		words_[i] = 0;
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::set()
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] = static_cast<word_type>(~word_type());
+	trim();
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::set(size_t pos, bool value)
+{
+	assert(pos < N);
+	if (pos < N)
+	{
+		if (value)
+			words_[pos / WordBits] |= mask(pos);
+		else
+			words_[pos / WordBits] &= static_cast<word_type>(~mask(pos));
+	}
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::reset()
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] = 0;
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::flip()
+{
+	for (size_t i = 0; i < Words; ++i)
+		words_[i] = static_cast<word_type>(~words_[i]);
+	trim();
+
+	return *this;
+}
+
+template<size_t N>
+std_bitset<N>& std_bitset<N>::flip(size_t pos)
+{
+	assert(pos < N);
+	if (pos < N)
+		words_[pos / WordBits] ^= mask(pos);
+
+	return *this;
+}
+
+template<size_t N>
+unsigned long std_bitset<N>::to_ulong() const
+{
+	return static_cast<unsigned long>(to_ullong());
+}
+
+template<size_t N>
+unsigned long long std_bitset<N>::to_ullong() const
+{
+	const size_t n = Words < sizeof(unsigned long long) / sizeof(word_type) ?
+		Words : sizeof(unsigned long long) / sizeof(word_type);
+	unsigned long long value = 0;
+
+	for (size_t i = n; i-- > 0;)
+	{
+		value = sizeof(value) > sizeof(word_type) ? value << (WordBits % (sizeof(value) * CHAR_BIT)) : 0;
+		value |= words_[i];
+	}
+
+	return value;
+}
+
+template<size_t N>
+bool std_bitset<N>::operator==(const self_type& other) const
+{
+	for (size_t i = 0; i < Words; ++i)
+		if (words_[i] != other.words_[i])
+			return false;
+
+	return true;
+}
+
+template<size_t N>
+size_t std_bitset<N>::find_next(size_t pos) const
+{
+	if (++pos >= N)
+		return N;
+
+	return find_from(pos / WordBits, static_cast<word_type>(words_[pos / WordBits] & ~(mask(pos) - 1)));
+}
+
+template<size_t N>
+size_t std_bitset<N>::find_from(size_t i, word_type w) const
+{
+	for (;;)
+	{
+		if (w)
+			return i * WordBits + std_countr_zero(w);
+		if (++i == Words)
+			return N;
+		w = words_[i];
+	}
+}
+
+template<size_t N>
+void std_bitset<N>::trim()
+{
+	words_[Words - 1] &= LastMask;
+}
+
+#pragma endregion
+
+#pragma region std_bitset_non-member_functions
+
+template<size_t N>
+std_bitset<N> operator&(const std_bitset<N>& lhs, const std_bitset<N>& rhs)
+{	// Returns the bitwise AND of two bitsets.
+	return std_bitset<N>(lhs) &= rhs;
+}
+
+template<size_t N>
+std_bitset<N> operator|(const std_bitset<N>& lhs, const std_bitset<N>& rhs)
+{	// Returns the bitwise OR of two bitsets.
+	return std_bitset<N>(lhs) |= rhs;
+}
+
+template<size_t N>
+std_bitset<N> operator^(const std_bitset<N>& lhs, const std_bitset<N>& rhs)
+{	// Returns the bitwise XOR of two bitsets.
+	return std_bitset<N>(lhs) ^= rhs;
+}
+
+#pragma endregion
+
+#endif // !defined BITSET_H__
@@ -91,7 +91,7 @@ template <class Rep>
 struct std_chrono_duration_values
 {
 	static constexpr Rep zero() { return Rep(0); }
-	static constexpr Rep min() { return std_numeric_limits<Rep>::min(); }
+	static constexpr Rep min() { return std_numeric_limits<Rep>::lowest(); }
 	static constexpr Rep max() { return std_numeric_limits<Rep>::max(); }
 };
 
@@ -0,0 +1,537 @@
+/*
+ *	This file defines C++ Standard Template Library (STL) execution policies
+ *	and parallel overloads of several algorithms.
+ *
+ *	***************************************************************************
+ *
+ *	File: execution.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the sequenced and parallel execution policies from
+ *		the <execution> header of a C++ Standard Template Library (STL)
+ *		implementation, and overloads of `std_for_each', `std_transform',
+ *		`std_accumulate', `std_count_if' and `std_sort' that take a policy
+ *		as their first argument, as in C++17:
+ *
+ *			std_sort(std_execution_par, trace, trace + n);
+ *
+ *		The sequenced policy `std_execution_seq' calls the ordinary algorithm.
+ *		On Linux host builds the parallel policy `std_execution_par' splits
+ *		the range into chunks and runs them on a pool of worker threads that
+ *		is created on first use, with one thread per hardware thread, and
+ *		the calling thread takes part. Ranges too short to be worth splitting,
+ *		and calls made from within a worker, run sequentially. On all other
+ *		targets, including AVR, the parallel policy compiles to the sequenced
+ *		algorithm. `EXECUTION_HAS_THREADS' is defined when the parallel
+ *		policy uses threads, and such builds must be compiled and linked with
+ *		`-pthread'.
+ *
+ *		The parallel overloads require random access iterators, and functions
+ *		passed to them must be safe to call concurrently on distinct elements.
+ *		`std_accumulate' combines chunk results in order, so its operation
+ *		must be associative, though it need not be commutative. `std_sort' is
+ *		a stable sort.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'. Thus, for example:
+ *
+ *			std::execution::par = std_execution_par,
+ *
+ *		and so forth.
+ *
+ *	**************************************************************************/
+
+#if !defined EXECUTION_H__
+# define EXECUTION_H__ 20261018L
+
+# include "type_traits.h"		// `std_integral_constant', `std_aligned_storage'.
+# include "functional.h"		// `std_less', `std_plus'.
+# include "iterator.h"			// `std_iterator_traits'.
+# include "algorithm.h"			// Sequential algorithms.
+# include "numeric.h"			// `std_accumulate()'.
+# include "uninitialized.h"		// `std_construct_at()', `std_destroy_at()'.
+
+# if defined __linux__ && !defined ARDUINO
+#  define EXECUTION_HAS_THREADS 1
+#  include <thread>				// Worker threads.
+#  include <mutex>				// Pool synchronization.
+#  include <condition_variable>	// Pool synchronization.
+#  include <atomic>				// Chunk counters.
+#  include <vector>				// Worker storage.
+# endif
+
+# pragma region execution_policies
+
+// Policy requiring that an algorithm runs sequentially on the calling thread.
+struct std_sequenced_policy {};
+
+// Policy permitting an algorithm to run in parallel.
+struct std_parallel_policy {};
+
+const std_sequenced_policy std_execution_seq = std_sequenced_policy();
+const std_parallel_policy std_execution_par = std_parallel_policy();
+
+template<class T>
+struct std_is_execution_policy : public std_false_type {};
+
+template<>
+struct std_is_execution_policy<std_sequenced_policy> : public std_true_type {};
+
+template<>
+struct std_is_execution_policy<std_parallel_policy> : public std_true_type {};
+
+# pragma endregion
+
+# if defined EXECUTION_HAS_THREADS
+
+# pragma region std_thread_pool
+
+// Pool of worker threads that runs the chunks of one parallel algorithm at a
+// time. Concurrent callers are serialized.
+class std_thread_pool
+{
+public:		/**** Member Types and Constants ****/
+	// Function that runs chunk `i' with context `ctx'.
+	typedef void(*job_type)(void* ctx, size_t i);
+
+private:
+	// The chunks of one call to `run()'.
+	struct Batch
+	{
+		job_type		job;	// Function that runs a chunk.
+		void*			ctx;	// Job context.
+		size_t			count;	// Number of chunks.
+		unsigned long	id;		// Sequence number.
+	};
+
+public:		/**** Ctors ****/
+	std_thread_pool(const std_thread_pool&) = delete;
+	std_thread_pool& operator=(const std_thread_pool&) = delete;
+	~std_thread_pool();
+
+public:		/**** Member Functions ****/
+	// Returns the process-wide pool.
+	static std_thread_pool& instance();
+	// Returns the number of threads that run chunks, including the caller.
+	size_t		concurrency() const { return workers_.size() + 1; }
+	// Returns `true' if the calling thread is running a chunk.
+	static bool	in_parallel() { return parallel_flag(); }
+	// Runs `job(ctx, i)' for each `i' in [0, n) and returns when all are done.
+	void		run(job_type, void*, size_t);
+
+private:
+	std_thread_pool();
+
+	static bool& parallel_flag() { static thread_local bool flag = false; return flag; }
+	// Runs chunks of `batch', a copy of the current batch, until none remain.
+	void		drain(const Batch&);
+	// Worker thread loop.
+	void		work();
+
+private:	/**** Member Objects ****/
+	std::vector<std::thread>	workers_;	// Worker threads.
+	std::mutex					mutex_;		// Guards the batch state.
+	std::mutex					caller_;	// Serializes callers of `run()'.
+	std::condition_variable		start_;		// Signals a new batch or shutdown.
+	std::condition_variable		done_;		// Signals batch completion.
+	Batch						batch_;		// Current batch.
+	std::atomic<size_t>			next_;		// Next chunk to run.
+	std::atomic<size_t>			finished_;	// Number of chunks run.
+	size_t						active_;	// Number of workers running chunks.
+	bool						stop_;		// Shutdown flag.
+};
+
+# pragma endregion
+
+#pragma region std_thread_pool_member_functions
+
+inline std_thread_pool::std_thread_pool() :
+	workers_(), mutex_(), caller_(), start_(), done_(), batch_(),
+	next_(0), finished_(0), active_(), stop_()
+{
+	unsigned n = std::thread::hardware_concurrency();
+
+	for (unsigned i = 1; i < n; ++i)
+		workers_.emplace_back(&std_thread_pool::work, this);
+}
+
+inline std_thread_pool::~std_thread_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	start_.notify_all();
+	for (std::thread& t : workers_)
+		t.join();
+}
+
+inline std_thread_pool& std_thread_pool::instance()
+{
+	static std_thread_pool pool;
+
+	return pool;
+}
+
+inline void std_thread_pool::run(job_type job, void* ctx, size_t n)
+{
+	std::lock_guard<std::mutex> serial(caller_);
+	std::unique_lock<std::mutex> lock(mutex_);
+	Batch batch;
+
+	// A worker that woke too late for the last batch may still be claiming
+	// chunks from it, so it must be done before the chunk counter is reset.
+	done_.wait(lock, [this] { return active_ == 0; });
+	batch_.job = job;
+	batch_.ctx = ctx;
+	batch_.count = n;
+	++batch_.id;
+	next_.store(0);
+	finished_.store(0);
+	batch = batch_;
+	lock.unlock();
+	start_.notify_all();
+	parallel_flag() = true;
+	drain(batch);
+	parallel_flag() = false;
+
+	// Workers may still be running chunks, or about to find none remain.
+	lock.lock();
+	done_.wait(lock, [this, n] { return finished_.load() == n && active_ == 0; });
+}
+
+inline void std_thread_pool::drain(const Batch& batch)
+{
+	size_t i, n = 0;
+
+	while ((i = next_.fetch_add(1)) < batch.count)
+	{
+		batch.job(batch.ctx, i);
+		++n;
+	}
+	finished_.fetch_add(n);
+}
+
+inline void std_thread_pool::work()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	unsigned long seen = 0;
+
+	parallel_flag() = true;
+	for (;;)
+	{
+		start_.wait(lock, [this, seen] { return stop_ || batch_.id != seen; });
+		if (stop_)
+			return;
+		seen = batch_.id;
+		if (finished_.load() == batch_.count)
+			continue;	// Woke after the batch was finished, skip it.
+
+		// The batch is copied under the lock, and `run()' doesn't start another while it's active.
+		const Batch batch = batch_;
+
+		++active_;
+		lock.unlock();
+		drain(batch);
+		lock.lock();
+		if (--active_ == 0)
+			done_.notify_all();
+	}
+}
+
+#pragma endregion
+
+# endif // defined EXECUTION_HAS_THREADS
+
+namespace
+{
+	// Smallest number of elements worth giving to a thread.
+	const size_t std_parallel_min_chunk = 4096;
+	// Largest number of chunks, more than the hardware threads of any host.
+	const size_t std_parallel_max_chunks = 64;
+
+	// Returns the number of chunks to split a range of `n' elements into.
+	inline size_t std_parallel_chunks(size_t n)
+	{
+# if defined EXECUTION_HAS_THREADS
+		if (std_thread_pool::in_parallel())
+			return 1;
+
+		size_t chunks = n / std_parallel_min_chunk, threads = std_thread_pool::instance().concurrency();
+
+		if (threads > std_parallel_max_chunks)
+			threads = std_parallel_max_chunks;
+
+		return chunks == 0 ? 1 : chunks < threads ? chunks : threads;
+# else
+		(void)n;
+		return 1;
+# endif
+	}
+
+	// Runs `fn(i)' for each chunk `i' in [0, n).
+	template<class Function>
+	void std_parallel_run(Function& fn, size_t n)
+	{
+# if defined EXECUTION_HAS_THREADS
+		if (n > 1)
+		{
+			struct Thunk { static void call(void* ctx, size_t i) { (*static_cast<Function*>(ctx))(i); } };
+			std_thread_pool::instance().run(&Thunk::call, &fn, n);
+			return;
+		}
+# endif
+		for (size_t i = 0; i < n; ++i)
+			fn(i);
+	}
+
+	// Returns the start of chunk `i' of `chunks' in a range of `n' elements.
+	inline size_t std_chunk_begin(size_t n, size_t chunks, size_t i)
+	{
+		return n / chunks * i + (i < n % chunks ? i : n % chunks);
+	}
+
+	template<class RandomIt, class Function>
+	struct std_for_each_chunk
+	{
+		RandomIt first; size_t n, chunks; Function fn;
+		void operator()(size_t i)
+		{
+			std_for_each(first + std_chunk_begin(n, chunks, i), first + std_chunk_begin(n, chunks, i + 1), fn);
+		}
+	};
+
+	template<class RandomIt, class OutputIt, class UnaryOperation>
+	struct std_transform_chunk
+	{
+		RandomIt first; OutputIt dest; size_t n, chunks; UnaryOperation op;
+		void operator()(size_t i)
+		{
+			size_t b = std_chunk_begin(n, chunks, i), e = std_chunk_begin(n, chunks, i + 1);
+			std_transform(first + b, first + e, dest + b, op);
+		}
+	};
+
+	template<class RandomIt1, class RandomIt2, class OutputIt, class BinaryOperation>
+	struct std_transform2_chunk
+	{
+		RandomIt1 first1; RandomIt2 first2; OutputIt dest; size_t n, chunks; BinaryOperation op;
+		void operator()(size_t i)
+		{
+			size_t b = std_chunk_begin(n, chunks, i), e = std_chunk_begin(n, chunks, i + 1);
+			std_transform(first1 + b, first1 + e, first2 + b, dest + b, op);
+		}
+	};
+
+	template<class RandomIt, class T, class BinaryOperation>
+	struct std_accumulate_chunk
+	{
+		RandomIt first; size_t n, chunks; BinaryOperation op; T* results;
+		void operator()(size_t i)
+		{	// Chunks are never empty, so each starts from its first element. `results' is raw storage.
+			RandomIt b = first + std_chunk_begin(n, chunks, i), e = first + std_chunk_begin(n, chunks, i + 1);
+			std_construct_at(results + i, std_accumulate(b + 1, e, T(*b), op));
+		}
+	};
+
+	template<class RandomIt, class UnaryPredicate>
+	struct std_count_if_chunk
+	{
+		RandomIt first; size_t n, chunks; UnaryPredicate p; ptrdiff_t* results;
+		void operator()(size_t i)
+		{
+			results[i] = std_count_if(first + std_chunk_begin(n, chunks, i), first + std_chunk_begin(n, chunks, i + 1), p);
+		}
+	};
+
+	template<class RandomIt, class Compare>
+	struct std_sort_chunk
+	{
+		RandomIt first; size_t n, chunks, width; Compare comp;
+		void operator()(size_t i)
+		{	// Sorts chunk `i' if `width' is zero, else merges chunks `i * width' and `i * width + width / 2'.
+			if (width == 0)
+				std_stable_sort(first + std_chunk_begin(n, chunks, i), first + std_chunk_begin(n, chunks, i + 1), comp);
+			else
+			{
+				size_t lo = i * width, mid = lo + width / 2, hi = lo + width < chunks ? lo + width : chunks;
+				if (mid < hi)
+					std_inplace_merge(first + std_chunk_begin(n, chunks, lo), first + std_chunk_begin(n, chunks, mid),
+						first + std_chunk_begin(n, chunks, hi), comp);
+			}
+		}
+	};
+} // namespace
+
+#pragma region execution_policy_algorithms
+
+template<class InputIt, class Function>
+void std_for_each(std_sequenced_policy, InputIt first, InputIt last, Function fn)
+{
+	std_for_each(first, last, fn);
+}
+
+template<class RandomIt, class Function>
+void std_for_each(std_parallel_policy, RandomIt first, RandomIt last, Function fn)
+{
+	size_t n = last - first, chunks = std_parallel_chunks(n);
+	std_for_each_chunk<RandomIt, Function> job = { first, n, chunks, fn };
+
+	std_parallel_run(job, chunks);
+}
+
+template<class InputIt, class OutputIt, class UnaryOperation>
+OutputIt std_transform(std_sequenced_policy, InputIt first, InputIt last, OutputIt dest, UnaryOperation op)
+{
+	return std_transform(first, last, dest, op);
+}
+
+template<class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt std_transform(std_parallel_policy, RandomIt first, RandomIt last, OutputIt dest, UnaryOperation op)
+{
+	size_t n = last - first, chunks = std_parallel_chunks(n);
+	std_transform_chunk<RandomIt, OutputIt, UnaryOperation> job = { first, dest, n, chunks, op };
+
+	std_parallel_run(job, chunks);
+
+	return dest + n;
+}
+
+template<class InputIt1, class InputIt2, class OutputIt, class BinaryOperation>
+OutputIt std_transform(std_sequenced_policy, InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt dest, BinaryOperation op)
+{
+	return std_transform(first1, last1, first2, dest, op);
+}
+
+template<class RandomIt1, class RandomIt2, class OutputIt, class BinaryOperation>
+OutputIt std_transform(std_parallel_policy, RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, OutputIt dest, BinaryOperation op)
+{
+	size_t n = last1 - first1, chunks = std_parallel_chunks(n);
+	std_transform2_chunk<RandomIt1, RandomIt2, OutputIt, BinaryOperation> job = { first1, first2, dest, n, chunks, op };
+
+	std_parallel_run(job, chunks);
+
+	return dest + n;
+}
+
+template<class InputIt, class T, class BinaryOperation>
+T std_accumulate(std_sequenced_policy, InputIt first, InputIt last, T init, BinaryOperation op)
+{
+	return std_accumulate(first, last, init, op);
+}
+
+template<class InputIt, class T>
+T std_accumulate(std_sequenced_policy, InputIt first, InputIt last, T init)
+{
+	return std_accumulate(first, last, init);
+}
+
+template<class RandomIt, class T, class BinaryOperation>
+T std_accumulate(std_parallel_policy, RandomIt first, RandomIt last, T init, BinaryOperation op)
+{
+	size_t n = last - first, chunks = std_parallel_chunks(n);
+
+	if (chunks == 1)
+		return std_accumulate(first, last, init, op);
+
+	// Uninitialized, so `T' needn't be default constructible.
+	typename std_aligned_storage<sizeof(T), alignof(T)>::type storage[std_parallel_max_chunks];
+	T* results = reinterpret_cast<T*>(storage);
+	std_accumulate_chunk<RandomIt, T, BinaryOperation> job = { first, n, chunks, op, results };
+
+	std_parallel_run(job, chunks);
+	for (size_t i = 0; i < chunks; ++i)
+	{
+		init = op(init, results[i]);
+		std_destroy_at(results + i);
+	}
+
+	return init;
+}
+
+template<class RandomIt, class T>
+T std_accumulate(std_parallel_policy policy, RandomIt first, RandomIt last, T init)
+{
+	return std_accumulate(policy, first, last, init, std_plus<T>());
+}
+
+template<class InputIt, class UnaryPredicate>
+	typename std_iterator_traits<InputIt>::difference_type
+		std_count_if(std_sequenced_policy, InputIt first, InputIt last, UnaryPredicate p)
+{
+	return std_count_if(first, last, p);
+}
+
+template<class RandomIt, class UnaryPredicate>
+	typename std_iterator_traits<RandomIt>::difference_type
+		std_count_if(std_parallel_policy, RandomIt first, RandomIt last, UnaryPredicate p)
+{
+	size_t n = last - first, chunks = std_parallel_chunks(n);
+	ptrdiff_t results[std_parallel_max_chunks], count = 0;
+	std_count_if_chunk<RandomIt, UnaryPredicate> job = { first, n, chunks, p, results };
+	std_parallel_run(job, chunks);
+	for (size_t i = 0; i < chunks; ++i)
+		count += results[i];
+
+	return count;
+}
+
+template<class RandomIt>
+void std_sort(std_sequenced_policy policy, RandomIt first, RandomIt last)
+{
+	std_sort(policy, first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+template<class RandomIt, class Compare>
+void std_sort(std_sequenced_policy, RandomIt first, RandomIt last, Compare comp)
+{
+	std_stable_sort(first, last, comp);
+}
+
+template<class RandomIt, class Compare>
+void std_sort(std_parallel_policy, RandomIt first, RandomIt last, Compare comp)
+{
+	size_t n = last - first, chunks = std_parallel_chunks(n);
+	std_sort_chunk<RandomIt, Compare> job = { first, n, chunks, 0, comp };
+
+	// Sort the chunks, then merge adjacent runs of chunks in rounds.
+	std_parallel_run(job, chunks);
+	for (job.width = 2; job.width / 2 < chunks; job.width *= 2)
+		std_parallel_run(job, (chunks + job.width - 1) / job.width);
+}
+
+template<class RandomIt>
+void std_sort(std_parallel_policy policy, RandomIt first, RandomIt last)
+{
+	std_sort(policy, first, last, std_less<typename std_iterator_traits<RandomIt>::value_type>());
+}
+
+#pragma endregion
+
+#endif // !defined EXECUTION_H__
@@ -0,0 +1,351 @@
+/*
+ *	This file defines C++ Standard Template Library (STL) style fixed-point
+ *	arithmetic types.
+ *
+ *	***************************************************************************
+ *
+ *	File: fixed.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_fixed' class template, which is not part
+ *		of the Standard. A `std_fixed<IntBits, FracBits>' is a signed binary
+ *		fixed-point number in Q notation: `IntBits' integer bits, including
+ *		the sign bit, and `FracBits' fraction bits, stored in the smallest
+ *		integral type that holds them. Arithmetic compiles to integer adds,
+ *		multiplies and shifts, which on MCUs without an FPU, such as AVR, is
+ *		many times faster than soft-float and never drags in the float
+ *		library. The common formats have aliases:
+ *
+ *			std_q8_8	- 16 bits, range [-128, 128), resolution 1/256.
+ *			std_q16_16	- 32 bits, range [-32768, 32768), resolution 1/65536.
+ *			std_q1_15	- 16 bits, range [-1, 1), resolution 1/32768.
+ *
+ *		The `Overflow' policy decides what happens when a result is out of
+ *		range. `std_fixed_saturate', the default, clamps it to the nearest
+ *		limit, which is what control loops and servo mappings usually want.
+ *		`std_fixed_wrap' discards the high bits like integer arithmetic,
+ *		which is cheaper and suits phase accumulators. Conversions from
+ *		floating-point values always saturate, and NaN converts to zero.
+ *
+ *		Products are rounded to nearest and quotients truncated toward zero.
+ *		Division is the slowest operation, so dividing repeatedly by the same
+ *		value is best done by multiplying by its `reciprocal()', and scaling
+ *		by an integer should use the integer overloads of `*' and `/', which
+ *		need no widening:
+ *
+ *			const std_q16_16 k = std_q16_16(ServoMaxAngle).reciprocal();
+ *			std_q16_16 fraction = std_q16_16(angle) * k;
+ *
+ *		Construction from numbers is explicit, so mixed expressions must
+ *		say which side is fixed-point. `std_numeric_limits' is specialized
+ *		for every format in <numeric_limits.h>.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined FIXED_H__
+# define FIXED_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <limits.h>			// `CHAR_BIT'.
+# include <stdint.h>			// Fixed-width integral types.
+# include "type_traits.h"		// `std_conditional', `std_enable_if', `std_is_integral'.
+# include "numeric_limits.h"	// `std_numeric_limits'.
+
+// Overflow policy that clamps out-of-range results to the nearest limit.
+struct std_fixed_saturate
+{
+	static constexpr bool saturating = true;
+};
+
+// Overflow policy that discards the high bits of out-of-range results.
+struct std_fixed_wrap
+{
+	static constexpr bool saturating = false;
+};
+
+# pragma region std_fixed
+
+// Signed binary fixed-point number with `IntBits' integer and `FracBits' fraction bits.
+template<int IntBits, int FracBits, class Overflow = std_fixed_saturate>
+class std_fixed
+{
+	static_assert(IntBits > 0 && FracBits >= 0, "std_fixed needs a sign bit and non-negative fraction bits.");
+	static_assert(IntBits + FracBits <= 32, "std_fixed is limited to 32 bits.");
+
+	template<int I, int F, class P> friend class std_fixed;
+
+public:		/**** Member Types and Constants ****/
+	typedef std_fixed<IntBits, FracBits, Overflow> self_type;
+	typedef Overflow overflow_policy;
+	static const int Bits = IntBits + FracBits;
+	// Smallest signed type holding `Bits' bits.
+	typedef typename std_conditional<(Bits <= 8), int8_t,
+		typename std_conditional<(Bits <= 16), int16_t, int32_t>::type>::type raw_type;
+	// Type holding the full product of two `raw_type' values.
+	typedef typename std_conditional<(Bits <= 8), int16_t,
+		typename std_conditional<(Bits <= 16), int32_t, int64_t>::type>::type wide_type;
+
+	static constexpr raw_type RawMax = raw_type((wide_type(1) << (Bits - 1)) - 1);
+	static constexpr raw_type RawMin = raw_type(-RawMax - 1);
+	static constexpr wide_type One = wide_type(1) << FracBits;
+
+public:		/**** Ctors ****/
+	constexpr std_fixed() : raw_() {}
+	template<class I, class = typename std_enable_if<std_is_integral<I>::value>::type>
+	constexpr explicit std_fixed(I value) : raw_(from_int(int64_t(value))) {}
+	constexpr explicit std_fixed(double value) : raw_(from_double(value * One)) {}
+	template<int I, int F, class P>
+	constexpr explicit std_fixed(const std_fixed<I, F, P>& other) : raw_(narrow(rescale<F>(other.raw_))) {}
+
+	// Returns a value whose underlying representation is `raw'.
+	static constexpr self_type from_raw(raw_type raw) { return self_type(raw, RawTag()); }
+
+public:		/**** Member Functions ****/
+	constexpr raw_type		raw() const { return raw_; }
+	// Returns the integral part, rounded toward negative infinity.
+	constexpr int32_t		to_int() const { return raw_ >> FracBits; }
+	constexpr explicit operator float() const { return float(raw_) / float(One); }
+	constexpr explicit operator double() const { return double(raw_) / double(One); }
+	// Returns 1 / *this, for dividing by the same value repeatedly.
+	self_type				reciprocal() const { return self_type(1) / *this; }
+	constexpr self_type		operator+() const { return *this; }
+	constexpr self_type		operator-() const { return from_raw(narrow(-wide_type(raw_))); }
+	self_type&				operator+=(self_type other) { raw_ = narrow(wide_type(raw_) + other.raw_); return *this; }
+	self_type&				operator-=(self_type other) { raw_ = narrow(wide_type(raw_) - other.raw_); return *this; }
+	self_type&				operator*=(self_type);
+	self_type&				operator/=(self_type);
+	// Multiplies by an integer, which needs no rounding.
+	self_type&				operator*=(int n) { raw_ = narrow(wide_type(raw_) * n); return *this; }
+	// Divides by an integer, which needs no widening.
+	self_type&				operator/=(int);
+
+private:
+	struct RawTag {};
+
+	constexpr std_fixed(raw_type raw, RawTag) : raw_(raw) {}
+
+	// Converts a wide result to `raw_type' according to the overflow policy.
+	template<class W>
+	static constexpr raw_type narrow(W value)
+	{
+		return narrow(value, std_integral_constant<bool, Overflow::saturating>());
+	}
+	template<class W>
+	static constexpr raw_type narrow(W value, std_true_type)
+	{
+		return value > W(RawMax) ? raw_type(RawMax) : value < W(RawMin) ? raw_type(RawMin) : raw_type(value);
+	}
+	template<class W>
+	static constexpr raw_type narrow(W value, std_false_type)
+	{
+		// Keep the low `Bits' bits, sign-extending them if `raw_type' is wider.
+		return Bits == CHAR_BIT * sizeof(raw_type) ? raw_type(value)
+			: raw_type(int64_t(static_cast<uint64_t>(value) << (64 - Bits)) >> (64 - Bits));
+	}
+
+	// Scales an integer by `One' according to the overflow policy.
+	static constexpr raw_type from_int(int64_t value)
+	{
+		// Saturating clamps first so the product can't overflow, wrapping keeps the low bits.
+		return Overflow::saturating ? narrow(clamp_int(value) * One) : narrow(static_cast<uint64_t>(value) << FracBits);
+	}
+
+	// Clamps an integer so that scaling it by `One' can't overflow `wide_type'.
+	static constexpr wide_type clamp_int(int64_t value)
+	{
+		return value > (RawMax >> FracBits) ? wide_type(RawMax >> FracBits) + 1
+			: value < (RawMin >> FracBits) ? wide_type(RawMin >> FracBits) - 1 : wide_type(value);
+	}
+
+	// Rounds and saturates a scaled floating-point value, NaN converts to zero.
+	static constexpr raw_type from_double(double scaled)
+	{
+		return scaled != scaled ? raw_type(0) : scaled >= RawMax ? RawMax : scaled <= RawMin ? RawMin
+			: raw_type(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+	}
+
+	// Rescales the raw value of a format with `F' fraction bits to this format.
+	template<int F>
+	static constexpr int64_t rescale(int64_t raw)
+	{
+		return F > FracBits ? raw >> (F > FracBits ? F - FracBits : 0) : raw * (int64_t(1) << (FracBits > F ? FracBits - F : 0));
+	}
+
+private:	/**** Member Objects ****/
+	raw_type raw_;	// Value scaled by 2^FracBits.
+};
+
+template<int IntBits, int FracBits, class Overflow>
+const int std_fixed<IntBits, FracBits, Overflow>::Bits;
+template<int IntBits, int FracBits, class Overflow>
+constexpr typename std_fixed<IntBits, FracBits, Overflow>::raw_type std_fixed<IntBits, FracBits, Overflow>::RawMax;
+template<int IntBits, int FracBits, class Overflow>
+constexpr typename std_fixed<IntBits, FracBits, Overflow>::raw_type std_fixed<IntBits, FracBits, Overflow>::RawMin;
+template<int IntBits, int FracBits, class Overflow>
+constexpr typename std_fixed<IntBits, FracBits, Overflow>::wide_type std_fixed<IntBits, FracBits, Overflow>::One;
+
+typedef std_fixed<8, 8> std_q8_8;
+typedef std_fixed<16, 16> std_q16_16;
+typedef std_fixed<1, 15> std_q1_15;
+
+# pragma endregion
+
+#pragma region std_fixed_member_functions
+
+template<int IntBits, int FracBits, class Overflow>
+std_fixed<IntBits, FracBits, Overflow>& std_fixed<IntBits, FracBits, Overflow>::operator*=(self_type other)
+{
+	// Round to nearest by adding half of the discarded bits before shifting.
+	wide_type product = wide_type(raw_) * other.raw_;
+
+	if (FracBits > 0)
+		product = (product + (One >> 1)) >> FracBits;
+	raw_ = narrow(product);
+
+	return *this;
+}
+
+template<int IntBits, int FracBits, class Overflow>
+std_fixed<IntBits, FracBits, Overflow>& std_fixed<IntBits, FracBits, Overflow>::operator/=(self_type other)
+{
+	assert(other.raw_ != 0);
+	if (other.raw_ == 0)
+		raw_ = raw_ < 0 ? RawMin : RawMax;
+	else
+		raw_ = narrow(wide_type(raw_) * One / other.raw_);
+
+	return *this;
+}
+
+template<int IntBits, int FracBits, class Overflow>
+std_fixed<IntBits, FracBits, Overflow>& std_fixed<IntBits, FracBits, Overflow>::operator/=(int n)
+{
+	assert(n != 0);
+	if (n == 0)
+		raw_ = raw_ < 0 ? RawMin : RawMax;
+	else
+		raw_ = narrow(wide_type(raw_) / n);
+
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region std_fixed_non-member_functions
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator+(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns the sum of two fixed-point values.
+	return lhs += rhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator-(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns the difference of two fixed-point values.
+	return lhs -= rhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator*(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns the product of two fixed-point values.
+	return lhs *= rhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator*(std_fixed<I, F, P> lhs, int rhs)
+{	// Returns the product of a fixed-point value and an integer.
+	return lhs *= rhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator*(int lhs, std_fixed<I, F, P> rhs)
+{	// Returns the product of an integer and a fixed-point value.
+	return rhs *= lhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator/(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns the quotient of two fixed-point values.
+	return lhs /= rhs;
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> operator/(std_fixed<I, F, P> lhs, int rhs)
+{	// Returns the quotient of a fixed-point value and an integer.
+	return lhs /= rhs;
+}
+
+template<int I, int F, class P>
+constexpr bool operator==(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if the values are equal.
+	return lhs.raw() == rhs.raw();
+}
+
+template<int I, int F, class P>
+constexpr bool operator!=(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if the values are not equal.
+	return lhs.raw() != rhs.raw();
+}
+
+template<int I, int F, class P>
+constexpr bool operator<(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if `lhs' is less than `rhs'.
+	return lhs.raw() < rhs.raw();
+}
+
+template<int I, int F, class P>
+constexpr bool operator<=(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if `lhs' is less than or equal to `rhs'.
+	return lhs.raw() <= rhs.raw();
+}
+
+template<int I, int F, class P>
+constexpr bool operator>(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if `lhs' is greater than `rhs'.
+	return lhs.raw() > rhs.raw();
+}
+
+template<int I, int F, class P>
+constexpr bool operator>=(std_fixed<I, F, P> lhs, std_fixed<I, F, P> rhs)
+{	// Returns true if `lhs' is greater than or equal to `rhs'.
+	return lhs.raw() >= rhs.raw();
+}
+
+template<int I, int F, class P>
+std_fixed<I, F, P> std_abs(std_fixed<I, F, P> x)
+{	// Returns the absolute value of `x', saturated if `x' is the least value.
+	return x < std_fixed<I, F, P>() ? -x : x;
+}
+
+#pragma endregion
+
+#endif // !defined FIXED_H__
@@ -0,0 +1,446 @@
+/*
+ *	This file defines a fixed-capacity open-addressing hash map.
+ *
+ *	***************************************************************************
+ *
+ *	File: fixed_hash_map.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_fixed_hash_map' type, an unordered
+ *		associative container of unique keys with a fixed number of slots
+ *		`N', which must be a power of two, and no dynamic memory allocation.
+ *
+ *		The map uses open addressing with Robin Hood hashing: each slot
+ *		records how far its element is from its home slot, and an element
+ *		being inserted takes the slot of any element closer to home than
+ *		itself, which keeps probe sequences short and uniform even at high
+ *		load factors. A lookup stops as soon as it reaches a slot whose
+ *		element is closer to home than the key being sought, so unsuccessful
+ *		searches are as cheap as successful ones. Erasure shifts the following
+ *		elements back one slot, so no tombstones are needed.
+ *
+ *		Probe distances are stored apart from the elements, in a byte array
+ *		that is scanned before any key is compared, and home slots are found
+ *		by masking the hash, so the map never divides.
+ *
+ *		Elements are `std_pair<K, V>' objects and both `K' and `V' must be
+ *		default constructible. The map holds at most `N' elements, but
+ *		lookups are fastest below about 90% occupancy.
+ *
+ *		Inserting into a full map fails. `insert()' reports this through its
+ *		return value. `operator[]' asserts, and with NDEBUG defined it returns
+ *		a reference to `sink()', a default-valued object shared by all maps
+ *		of the same type that is never an element:
+ *
+ *			uint8_t& value = table['z'];
+ *			if (&value == &table.sink())
+ *				...	// 'z' was not inserted.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined FIXED_HASH_MAP_H__
+# define FIXED_HASH_MAP_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stdint.h>			// Fixed-width integral types.
+# include "type_traits.h"		// `std_conditional'.
+# include "utility.h"			// `std_pair', `std_move()', `std_swap()'.
+# include "functional.h"		// `std_hash', `std_equal_to'.
+# include "iterator.h"			// `std_forward_iterator_tag'.
+
+# pragma region std_fixed_hash_map
+
+// Fixed-capacity unordered associative container of unique keys.
+template<class K, class V, size_t N, class Hash = std_hash<K>, class KeyEqual = std_equal_to<K>>
+class std_fixed_hash_map
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "std_fixed_hash_map capacity must be a power of two.");
+
+public:		/**** Member Types and Constants ****/
+	typedef std_fixed_hash_map<K, V, N, Hash, KeyEqual> self_type;
+	typedef K key_type;
+	typedef V mapped_type;
+	typedef std_pair<K, V> value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef Hash hasher;
+	typedef KeyEqual key_equal;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	// Probe distance plus one; zero marks an empty slot.
+	typedef typename std_conditional<(N < 256U), uint8_t, uint16_t>::type distance_type;
+
+	// Forward iterator over the occupied slots.
+	template<class Map, class Ref, class Ptr>
+	class Iterator
+	{
+	public:
+		typedef std_forward_iterator_tag iterator_category;
+		typedef typename std_fixed_hash_map::value_type value_type;
+		typedef typename std_fixed_hash_map::difference_type difference_type;
+		typedef Ptr pointer;
+		typedef Ref reference;
+
+	public:
+		Iterator() : map_(), slot_() {}
+		Iterator(Map* map, size_type slot) : map_(map), slot_(slot) { skip(); }
+		template<class M, class R, class P>
+		Iterator(const Iterator<M, R, P>& other) : map_(other.map_), slot_(other.slot_) {}
+
+	public:
+		reference operator*() const { return map_->slots_[slot_]; }
+		pointer operator->() const { return &map_->slots_[slot_]; }
+		Iterator& operator++() { ++slot_; skip(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+		template<class M, class R, class P>
+		bool operator==(const Iterator<M, R, P>& other) const { return slot_ == other.slot_; }
+		template<class M, class R, class P>
+		bool operator!=(const Iterator<M, R, P>& other) const { return slot_ != other.slot_; }
+
+	private:
+		// Advances to the next occupied slot or the end.
+		void skip() { while (slot_ < N && map_->dist_[slot_] == 0) ++slot_; }
+
+	private:
+		template<class M, class R, class P> friend class Iterator;
+		friend class std_fixed_hash_map;
+
+		Map*		map_;
+		size_type	slot_;
+	};
+
+	typedef Iterator<self_type, reference, pointer> iterator;
+	typedef Iterator<const self_type, const_reference, const_pointer> const_iterator;
+
+public:		/**** Ctors ****/
+	std_fixed_hash_map(const hasher& = hasher(), const key_equal& = key_equal());
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	std_fixed_hash_map(InputIt, InputIt, const hasher& = hasher(), const key_equal& = key_equal());
+
+public:		/**** Member Functions ****/
+	mapped_type&			at(const key_type&);
+	const mapped_type&		at(const key_type&) const;
+	mapped_type&			operator[](const key_type&);
+	// Returns the object that `operator[]' refers to when a new key doesn't fit.
+	static mapped_type&		sink() { return sink_; }
+	size_type				size() const { return size_; }
+	static constexpr size_type max_size() { return N; }
+	static constexpr size_type capacity() { return N; }
+	bool					empty() const { return size_ == 0; }
+	bool					full() const { return size_ == N; }
+	iterator				begin() { return iterator(this, 0); }
+	const_iterator			begin() const { return const_iterator(this, 0); }
+	const_iterator			cbegin() const { return const_iterator(this, 0); }
+	iterator				end() { return iterator(this, N); }
+	const_iterator			end() const { return const_iterator(this, N); }
+	const_iterator			cend() const { return const_iterator(this, N); }
+	std_pair<iterator, bool> insert(const_reference);
+	std_pair<iterator, bool> insert_or_assign(const key_type&, const mapped_type&);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	void					insert(InputIt, InputIt);
+	iterator				erase(const_iterator);
+	size_type				erase(const key_type&);
+	void					clear();
+	iterator				find(const key_type&);
+	const_iterator			find(const key_type&) const;
+	size_type				count(const key_type&) const;
+	bool					contains(const key_type&) const;
+	hasher					hash_function() const { return hash_; }
+	key_equal				key_eq() const { return equal_; }
+
+private:
+	static const size_type Mask = N - 1U;
+
+	// Returns the home slot of `key'.
+	size_type				home(const key_type& key) const { return hash_(key) & Mask; }
+	// Returns the slot holding `key', or `N' if not found.
+	size_type				locate(const key_type&) const;
+	// Inserts `value', whose key is not in the map, and returns its slot.
+	size_type				place(value_type);
+	// Empties slot `slot', shifting back the elements that follow.
+	void					remove(size_type);
+
+private:	/**** Member Objects ****/
+	distance_type	dist_[N];	// Probe distance plus one of each slot; zero if empty.
+	value_type		slots_[N];	// Element storage.
+	size_type		size_;		// Number of elements.
+	hasher			hash_;		// Hash function.
+	key_equal		equal_;		// Key equality.
+
+	static mapped_type	sink_;	// Target of `operator[]' when the map is full.
+};
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::mapped_type std_fixed_hash_map<K, V, N, Hash, KeyEqual>::sink_;
+
+# pragma endregion
+
+#pragma region std_fixed_hash_map_ctors
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+std_fixed_hash_map<K, V, N, Hash, KeyEqual>::std_fixed_hash_map(const hasher& hash, const key_equal& equal) :
+	dist_(), slots_(), size_(), hash_(hash), equal_(equal)
+{
+
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+template<class InputIt, class>
+std_fixed_hash_map<K, V, N, Hash, KeyEqual>::std_fixed_hash_map(InputIt first, InputIt last, const hasher& hash, const key_equal& equal) :
+	dist_(), slots_(), size_(), hash_(hash), equal_(equal)
+{
+	insert(first, last);
+}
+
+#pragma endregion
+
+#pragma region std_fixed_hash_map_member_functions
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::mapped_type&
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::at(const key_type& key)
+{
+	size_type slot = locate(key);
+
+	assert(slot != N);
+	if (slot == N)
+		slot = 0;	// Clamp to the first slot.
+
+	return slots_[slot].second;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+const typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::mapped_type&
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::at(const key_type& key) const
+{
+	size_type slot = locate(key);
+
+	assert(slot != N);
+	if (slot == N)
+		slot = 0;
+
+	return slots_[slot].second;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::mapped_type&
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::operator[](const key_type& key)
+{
+	size_type slot = locate(key);
+
+	if (slot == N)
+	{
+		assert(!full());
+		if (full())
+		{
+			sink_ = mapped_type();	// Discard anything written through an earlier failed call.
+			return sink_;
+		}
+		slot = place(value_type(key, mapped_type()));
+	}
+
+	return slots_[slot].second;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+std_pair<typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::iterator, bool>
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::insert(const_reference value)
+{
+	size_type slot = locate(value.first);
+
+	if (slot != N)
+		return std_pair<iterator, bool>(iterator(this, slot), false);
+	else if (full())
+		return std_pair<iterator, bool>(end(), false);
+
+	return std_pair<iterator, bool>(iterator(this, place(value)), true);
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+std_pair<typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::iterator, bool>
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::insert_or_assign(const key_type& key, const mapped_type& value)
+{
+	size_type slot = locate(key);
+
+	if (slot != N)
+	{
+		slots_[slot].second = value;
+		return std_pair<iterator, bool>(iterator(this, slot), false);
+	}
+	else if (full())
+		return std_pair<iterator, bool>(end(), false);
+
+	return std_pair<iterator, bool>(iterator(this, place(value_type(key, value))), true);
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+template<class InputIt, class>
+void std_fixed_hash_map<K, V, N, Hash, KeyEqual>::insert(InputIt first, InputIt last)
+{
+	for (; first != last && !full(); ++first)
+		insert(*first);
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::iterator
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::erase(const_iterator pos)
+{
+	size_type slot = pos.slot_;
+
+	remove(slot);
+	// An element following `pos' may have been shifted into its slot. If `pos'
+	// is the last slot, that element wraps from the first slot and is revisited.
+	return iterator(this, slot);
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::size_type
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::erase(const key_type& key)
+{
+	size_type slot = locate(key);
+
+	if (slot == N)
+		return 0;
+	remove(slot);
+
+	return 1;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+void std_fixed_hash_map<K, V, N, Hash, KeyEqual>::clear()
+{
+	for (size_type i = 0; i < N; ++i)
+	{
+		if (dist_[i])
+		{
+			dist_[i] = 0;
+			slots_[i] = value_type();
+		}
+	}
+	size_ = 0;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::iterator
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::find(const key_type& key)
+{
+	return iterator(this, locate(key));
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::const_iterator
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::find(const key_type& key) const
+{
+	return const_iterator(this, locate(key));
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::size_type
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::count(const key_type& key) const
+{
+	return contains(key) ? 1U : 0U;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+bool std_fixed_hash_map<K, V, N, Hash, KeyEqual>::contains(const key_type& key) const
+{
+	return locate(key) != N;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::size_type
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::locate(const key_type& key) const
+{
+	size_type slot = home(key);
+
+	// Stop at the first slot whose element is closer to its home than `key'
+	// would be here, which includes empty slots.
+	for (size_type dist = 1; dist_[slot] >= dist; ++dist, slot = (slot + 1) & Mask)
+	{
+		if (dist_[slot] == dist && equal_(slots_[slot].first, key))
+			return slot;
+	}
+
+	return N;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+typename std_fixed_hash_map<K, V, N, Hash, KeyEqual>::size_type
+	std_fixed_hash_map<K, V, N, Hash, KeyEqual>::place(value_type value)
+{
+	size_type slot = home(value.first), result = N;
+	distance_type dist = 1;
+
+	for (;; ++dist, slot = (slot + 1) & Mask)
+	{
+		if (dist_[slot] == 0)
+		{
+			slots_[slot] = std_move(value);
+			dist_[slot] = dist;
+			break;
+		}
+		else if (dist_[slot] < dist)
+		{	// Take the slot from an element closer to home, then carry on placing it.
+			std_swap(slots_[slot], value);
+			std_swap(dist_[slot], dist);
+			if (result == N)
+				result = slot;
+		}
+	}
+	++size_;
+
+	return result == N ? slot : result;
+}
+
+template<class K, class V, size_t N, class Hash, class KeyEqual>
+void std_fixed_hash_map<K, V, N, Hash, KeyEqual>::remove(size_type slot)
+{
+	size_type next = (slot + 1) & Mask;
+
+	// Shift back following elements until one is empty or already home.
+	while (dist_[next] > 1)
+	{
+		slots_[slot] = std_move(slots_[next]);
+		dist_[slot] = dist_[next] - 1;
+		slot = next;
+		next = (next + 1) & Mask;
+	}
+	dist_[slot] = 0;
+	slots_[slot] = value_type();
+	--size_;
+}
+
+#pragma endregion
+
+#endif // !defined FIXED_HASH_MAP_H__
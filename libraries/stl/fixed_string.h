@@ -0,0 +1,252 @@
+/*
+ *	This file defines a fixed-capacity C++ Standard Template Library (STL)
+ *	style string.
+ *
+ *	***************************************************************************
+ *
+ *	File: fixed_string.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_fixed_string' class, which is not part of
+ *		the Standard. It owns up to `N' chars, plus a terminating null, in
+ *		an embedded array and keeps their count, so it never allocates and
+ *		never has to be re-measured. It behaves like a bounded `std::string':
+ *		text that doesn't fit is truncated at `N' chars, which is usually
+ *		what a fixed-width field such as an event name or LCD row wants:
+ *
+ *			std_fixed_string<7> name("Closed");
+ *			name += " now";		// name == "Closed ".
+ *
+ *		A `std_fixed_string' converts implicitly to a `std_string_view', so
+ *		searching and comparison are done through views, and `c_str()'
+ *		always returns a null-terminated string for C and Arduino APIs.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined FIXED_STRING_H__
+# define FIXED_STRING_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <string.h>			// `memmove()', `memset()'.
+# include "string_view.h"		// `std_string_view'.
+
+# pragma region std_fixed_string
+
+// Fixed-capacity string of up to `N' chars.
+template<size_t N>
+class std_fixed_string
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_fixed_string<N> self_type;
+	typedef char value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef char& reference;
+	typedef const char& const_reference;
+	typedef char* pointer;
+	typedef const char* const_pointer;
+	typedef char* iterator;
+	typedef const char* const_iterator;
+
+	static const size_type npos = std_string_view::npos;
+
+public:		/**** Ctors ****/
+	std_fixed_string() : data_(), size_() {}
+	std_fixed_string(const char* s) : data_(), size_() { assign(std_string_view(s)); }
+	std_fixed_string(const char* s, size_type n) : data_(), size_() { assign(std_string_view(s, n)); }
+	std_fixed_string(std_string_view s) : data_(), size_() { assign(s); }
+	std_fixed_string(size_type n, char c) : data_(), size_() { assign(n, c); }
+
+	self_type& operator=(std_string_view s) { return assign(s); }
+	self_type& operator=(const char* s) { return assign(std_string_view(s)); }
+	self_type& operator=(char c) { return assign(1, c); }
+
+public:		/**** Member Functions ****/
+	iterator				begin() { return data_; }
+	const_iterator			begin() const { return data_; }
+	const_iterator			cbegin() const { return data_; }
+	iterator				end() { return data_ + size_; }
+	const_iterator			end() const { return data_ + size_; }
+	const_iterator			cend() const { return data_ + size_; }
+	size_type				size() const { return size_; }
+	size_type				length() const { return size_; }
+	static constexpr size_type max_size() { return N; }
+	static constexpr size_type capacity() { return N; }
+	bool					empty() const { return size_ == 0; }
+	bool					full() const { return size_ == N; }
+	reference				operator[](size_type pos) { return data_[pos]; }
+	const_reference			operator[](size_type pos) const { return data_[pos]; }
+	reference				front() { return data_[0]; }
+	const_reference			front() const { return data_[0]; }
+	reference				back() { return data_[size_ - 1]; }
+	const_reference			back() const { return data_[size_ - 1]; }
+	pointer					data() { return data_; }
+	const_pointer			data() const { return data_; }
+	const_pointer			c_str() const { return data_; }
+	operator std_string_view() const { return std_string_view(data_, size_); }
+	self_type&				assign(std_string_view);
+	self_type&				assign(size_type, char);
+	self_type&				append(std_string_view);
+	self_type&				append(size_type, char);
+	self_type&				operator+=(std_string_view s) { return append(s); }
+	self_type&				operator+=(const char* s) { return append(std_string_view(s)); }
+	self_type&				operator+=(char c) { push_back(c); return *this; }
+	void					push_back(char);
+	void					pop_back();
+	void					resize(size_type, char = '\0');
+	void					clear() { data_[size_ = 0] = '\0'; }
+	self_type&				erase(size_type = 0, size_type = npos);
+	int						compare(std_string_view s) const { return std_string_view(*this).compare(s); }
+	bool					starts_with(std_string_view s) const { return std_string_view(*this).starts_with(s); }
+	bool					ends_with(std_string_view s) const { return std_string_view(*this).ends_with(s); }
+	size_type				find(std_string_view s, size_type pos = 0) const { return std_string_view(*this).find(s, pos); }
+	size_type				find(char c, size_type pos = 0) const { return std_string_view(*this).find(c, pos); }
+	size_type				rfind(char c, size_type pos = npos) const { return std_string_view(*this).rfind(c, pos); }
+	std_string_view			substr(size_type pos = 0, size_type n = npos) const { return std_string_view(*this).substr(pos, n); }
+	void					swap(self_type&);
+
+private:	/**** Member Objects ****/
+	char		data_[N + 1];	// Chars plus terminating null.
+	size_type	size_;			// Number of chars.
+};
+
+# pragma endregion
+
+#pragma region std_fixed_string_member_functions
+
+template<size_t N>
+std_fixed_string<N>& std_fixed_string<N>::assign(std_string_view s)
+{
+	// `s' may refer to this string's own chars, which `memmove()' tolerates.
+	size_type n = s.size() < N ? s.size() : N;
+
+	if (n)
+		memmove(data_, s.data(), n);
+	data_[size_ = n] = '\0';
+
+	return *this;
+}
+
+template<size_t N>
+std_fixed_string<N>& std_fixed_string<N>::assign(size_type n, char c)
+{
+	clear();
+
+	return append(n, c);
+}
+
+template<size_t N>
+std_fixed_string<N>& std_fixed_string<N>::append(std_string_view s)
+{
+	size_type n = s.size() < N - size_ ? s.size() : N - size_;
+
+	if (n)
+		memmove(data_ + size_, s.data(), n);
+	data_[size_ += n] = '\0';
+
+	return *this;
+}
+
+template<size_t N>
+std_fixed_string<N>& std_fixed_string<N>::append(size_type n, char c)
+{
+	if (n > N - size_)
+		n = N - size_;
+	memset(data_ + size_, c, n);
+	data_[size_ += n] = '\0';
+
+	return *this;
+}
+
+template<size_t N>
+void std_fixed_string<N>::push_back(char c)
+{
+	if (size_ < N)
+	{
+		data_[size_++] = c;
+		data_[size_] = '\0';
+	}
+}
+
+template<size_t N>
+void std_fixed_string<N>::pop_back()
+{
+	assert(!empty());
+	if (size_)
+		data_[--size_] = '\0';
+}
+
+template<size_t N>
+void std_fixed_string<N>::resize(size_type n, char c)
+{
+	if (n > size_)
+		append(n - size_, c);
+	else
+		data_[size_ = n] = '\0';
+}
+
+template<size_t N>
+std_fixed_string<N>& std_fixed_string<N>::erase(size_type pos, size_type n)
+{
+	assert(pos <= size_);
+	if (pos > size_)
+		pos = size_;
+	if (n > size_ - pos)
+		n = size_ - pos;
+	memmove(data_ + pos, data_ + pos + n, size_ - pos - n + 1);
+	size_ -= n;
+
+	return *this;
+}
+
+template<size_t N>
+void std_fixed_string<N>::swap(self_type& other)
+{
+	self_type tmp(*this);
+
+	*this = other;
+	other = tmp;
+}
+
+#pragma endregion
+
+#pragma region std_fixed_string_non-member_functions
+
+template<size_t N>
+void swap(std_fixed_string<N>& lhs, std_fixed_string<N>& rhs)
+{	// Swaps the contents of two strings.
+	lhs.swap(rhs);
+}
+
+#pragma endregion
+
+#endif // !defined FIXED_STRING_H__
@@ -0,0 +1,419 @@
+/*
+ *	This file defines a fixed-capacity sorted associative container.
+ *
+ *	***************************************************************************
+ *
+ *	File: flat_map.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_flat_map' type, an associative container
+ *		of unique keys modeled on C++23's std::flat_map, but with a fixed
+ *		capacity `N' and no dynamic memory allocation. Key-value pairs are
+ *		kept sorted by key in a contiguous array and looked up by binary
+ *		search with `std_lower_bound', so lookups take O(log n) comparisons
+ *		and touch few cache lines. Insertion and erasure shift the elements
+ *		after the insertion point and take O(n) time, which makes the type
+ *		best suited to tables that are built once and searched often.
+ *
+ *		Elements are `std_pair<K, V>' objects rather than `std_pair<const K, V>'
+ *		so that they can be shifted by assignment. Clients must not modify
+ *		keys through iterators. Both `K' and `V' must be default constructible.
+ *
+ *		Maps can be built at compile time from an array of pairs that is
+ *		already sorted by key, with no duplicates:
+ *
+ *			constexpr std_pair<char, uint8_t> Init[] = { {'a', 1}, {'b', 2} };
+ *			const std_flat_map<char, uint8_t, 4> map(Init);
+ *
+ *		The range constructor accepts unsorted input and sorts it as it
+ *		inserts, discarding duplicate keys.
+ *
+ *		Inserting into a full map fails. `insert()' reports this through its
+ *		return value. `operator[]' asserts, and with NDEBUG defined it returns
+ *		a reference to `sink()', a default-valued object shared by all maps
+ *		of the same type that is never an element:
+ *
+ *			uint8_t& value = table['z'];
+ *			if (&value == &table.sink())
+ *				...	// 'z' was not inserted.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined FLAT_MAP_H__
+# define FLAT_MAP_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include "type_traits.h"		// `std_enable_if'.
+# include "utility.h"			// `std_pair', `std_index_sequence'.
+# include "functional.h"		// `std_less'.
+# include "algorithm.h"			// `std_lower_bound()', `std_upper_bound()'.
+
+# pragma region std_flat_map
+
+// Fixed-capacity sorted associative container of unique keys.
+template<class K, class V, size_t N, class Compare = std_less<K>>
+class std_flat_map
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_flat_map<K, V, N, Compare> self_type;
+	typedef K key_type;
+	typedef V mapped_type;
+	typedef std_pair<K, V> value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef Compare key_compare;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef pointer iterator;
+	typedef const_pointer const_iterator;
+
+	// Orders elements by key and compares elements to keys.
+	class value_compare
+	{
+	public:
+		explicit value_compare(const key_compare& comp = key_compare()) : comp_(comp) {}
+		bool operator()(const_reference lhs, const_reference rhs) const { return comp_(lhs.first, rhs.first); }
+		bool operator()(const_reference lhs, const key_type& rhs) const { return comp_(lhs.first, rhs); }
+		bool operator()(const key_type& lhs, const_reference rhs) const { return comp_(lhs, rhs.first); }
+
+	private:
+		key_compare comp_;
+	};
+
+public:		/**** Ctors ****/
+	constexpr std_flat_map() : data_(), size_(), comp_() {}
+	template<size_t M>
+	constexpr std_flat_map(const value_type(&)[M]);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	std_flat_map(InputIt, InputIt, const key_compare& = key_compare());
+
+public:		/**** Member Functions ****/
+	mapped_type&			at(const key_type&);
+	const mapped_type&		at(const key_type&) const;
+	mapped_type&			operator[](const key_type&);
+	// Returns the object that `operator[]' refers to when a new key doesn't fit.
+	static mapped_type&		sink() { return sink_; }
+	constexpr size_type		size() const { return size_; }
+	static constexpr size_type max_size() { return N; }
+	static constexpr size_type capacity() { return N; }
+	constexpr bool			empty() const { return size_ == 0; }
+	constexpr bool			full() const { return size_ == N; }
+	iterator				begin() { return data_; }
+	const_iterator			begin() const { return data_; }
+	const_iterator			cbegin() const { return data_; }
+	iterator				end() { return data_ + size_; }
+	const_iterator			end() const { return data_ + size_; }
+	const_iterator			cend() const { return data_ + size_; }
+	std_pair<iterator, bool> insert(const_reference);
+	std_pair<iterator, bool> insert_or_assign(const key_type&, const mapped_type&);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	void					insert(InputIt, InputIt);
+	iterator				erase(const_iterator);
+	size_type				erase(const key_type&);
+	void					clear() { size_ = 0; }
+	iterator				find(const key_type&);
+	const_iterator			find(const key_type&) const;
+	size_type				count(const key_type&) const;
+	bool					contains(const key_type&) const;
+	iterator				lower_bound(const key_type&);
+	const_iterator			lower_bound(const key_type&) const;
+	iterator				upper_bound(const key_type&);
+	const_iterator			upper_bound(const key_type&) const;
+	key_compare				key_comp() const { return comp_; }
+	value_compare			value_comp() const { return value_compare(comp_); }
+
+private:
+	template<size_t M, size_t... I>
+	constexpr std_flat_map(const value_type(&)[M], std_index_sequence<I...>);
+
+	// Returns `true' if the element at `it' has a key equal to `key'.
+	bool					matches(const_iterator, const key_type&) const;
+	// Inserts `value' at `pos' and returns its position.
+	iterator				emplace_at(iterator, const_reference);
+
+private:	/**** Member Objects ****/
+	value_type		data_[N == 0 ? 1U : N];	// Sorted element storage.
+	size_type		size_;					// Number of elements.
+	key_compare		comp_;					// Key ordering.
+
+	static mapped_type	sink_;				// Target of `operator[]' when the map is full.
+};
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::mapped_type std_flat_map<K, V, N, Compare>::sink_;
+
+# pragma endregion
+
+#pragma region std_flat_map_ctors
+
+template<class K, class V, size_t N, class Compare>
+template<size_t M>
+constexpr std_flat_map<K, V, N, Compare>::std_flat_map(const value_type(&init)[M]) :
+	std_flat_map(init, std_make_index_sequence<M>())
+{
+	static_assert(M <= N, "std_flat_map initializer exceeds capacity.");
+}
+
+template<class K, class V, size_t N, class Compare>
+template<size_t M, size_t... I>
+constexpr std_flat_map<K, V, N, Compare>::std_flat_map(const value_type(&init)[M], std_index_sequence<I...>) :
+	data_{ init[I]... }, size_(M), comp_()
+{
+
+}
+
+template<class K, class V, size_t N, class Compare>
+template<class InputIt, class>
+std_flat_map<K, V, N, Compare>::std_flat_map(InputIt first, InputIt last, const key_compare& comp) :
+	data_(), size_(), comp_(comp)
+{
+	insert(first, last);
+}
+
+#pragma endregion
+
+#pragma region std_flat_map_member_functions
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::mapped_type& std_flat_map<K, V, N, Compare>::at(const key_type& key)
+{
+	iterator it = find(key);
+
+	assert(it != end());
+	if (it == end())
+		it = data_;	// Clamp to the first element.
+
+	return it->second;
+}
+
+template<class K, class V, size_t N, class Compare>
+const typename std_flat_map<K, V, N, Compare>::mapped_type& std_flat_map<K, V, N, Compare>::at(const key_type& key) const
+{
+	const_iterator it = find(key);
+
+	assert(it != end());
+	if (it == end())
+		it = data_;
+
+	return it->second;
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::mapped_type& std_flat_map<K, V, N, Compare>::operator[](const key_type& key)
+{
+	iterator it = lower_bound(key);
+
+	if (!matches(it, key))
+	{
+		assert(!full());
+		if (full())
+		{
+			sink_ = mapped_type();	// Discard anything written through an earlier failed call.
+			return sink_;
+		}
+		it = emplace_at(it, value_type(key, mapped_type()));
+	}
+
+	return it->second;
+}
+
+template<class K, class V, size_t N, class Compare>
+std_pair<typename std_flat_map<K, V, N, Compare>::iterator, bool>
+	std_flat_map<K, V, N, Compare>::insert(const_reference value)
+{
+	iterator it = lower_bound(value.first);
+
+	if (matches(it, value.first))
+		return std_pair<iterator, bool>(it, false);
+	else if (full())
+		return std_pair<iterator, bool>(end(), false);
+
+	return std_pair<iterator, bool>(emplace_at(it, value), true);
+}
+
+template<class K, class V, size_t N, class Compare>
+std_pair<typename std_flat_map<K, V, N, Compare>::iterator, bool>
+	std_flat_map<K, V, N, Compare>::insert_or_assign(const key_type& key, const mapped_type& value)
+{
+	iterator it = lower_bound(key);
+
+	if (matches(it, key))
+	{
+		it->second = value;
+		return std_pair<iterator, bool>(it, false);
+	}
+	else if (full())
+		return std_pair<iterator, bool>(end(), false);
+
+	return std_pair<iterator, bool>(emplace_at(it, value_type(key, value)), true);
+}
+
+template<class K, class V, size_t N, class Compare>
+template<class InputIt, class>
+void std_flat_map<K, V, N, Compare>::insert(InputIt first, InputIt last)
+{
+	for (; first != last && !full(); ++first)
+		insert(*first);
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::iterator std_flat_map<K, V, N, Compare>::erase(const_iterator pos)
+{
+	iterator it = begin() + (pos - cbegin());
+
+	std_move(it + 1, end(), it);
+	--size_;
+
+	return it;
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::size_type std_flat_map<K, V, N, Compare>::erase(const key_type& key)
+{
+	iterator it = find(key);
+
+	if (it == end())
+		return 0;
+	erase(it);
+
+	return 1;
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::iterator std_flat_map<K, V, N, Compare>::find(const key_type& key)
+{
+	iterator it = lower_bound(key);
+
+	return matches(it, key) ? it : end();
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::const_iterator std_flat_map<K, V, N, Compare>::find(const key_type& key) const
+{
+	const_iterator it = lower_bound(key);
+
+	return matches(it, key) ? it : end();
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::size_type std_flat_map<K, V, N, Compare>::count(const key_type& key) const
+{
+	return contains(key) ? 1U : 0U;
+}
+
+template<class K, class V, size_t N, class Compare>
+bool std_flat_map<K, V, N, Compare>::contains(const key_type& key) const
+{
+	return find(key) != end();
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::iterator std_flat_map<K, V, N, Compare>::lower_bound(const key_type& key)
+{
+	return std_lower_bound(begin(), end(), key, value_comp());
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::const_iterator std_flat_map<K, V, N, Compare>::lower_bound(const key_type& key) const
+{
+	return std_lower_bound(begin(), end(), key, value_comp());
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::iterator std_flat_map<K, V, N, Compare>::upper_bound(const key_type& key)
+{
+	return std_upper_bound(begin(), end(), key, value_comp());
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::const_iterator std_flat_map<K, V, N, Compare>::upper_bound(const key_type& key) const
+{
+	return std_upper_bound(begin(), end(), key, value_comp());
+}
+
+template<class K, class V, size_t N, class Compare>
+bool std_flat_map<K, V, N, Compare>::matches(const_iterator it, const key_type& key) const
+{
+	return it != end() && !comp_(key, it->first);
+}
+
+template<class K, class V, size_t N, class Compare>
+typename std_flat_map<K, V, N, Compare>::iterator std_flat_map<K, V, N, Compare>::emplace_at(iterator pos, const_reference value)
+{
+	std_move_backward(pos, end(), end() + 1);
+	*pos = value;
+	++size_;
+
+	return pos;
+}
+
+#pragma endregion
+
+#pragma region std_flat_map_non-member_functions
+
+template<class K, class V, size_t N, class Compare>
+bool operator==(const std_flat_map<K, V, N, Compare>& lhs, const std_flat_map<K, V, N, Compare>& rhs)
+{	// Returns `true' if the contents of two containers are equal, else returns `false'.
+	return lhs.size() == rhs.size() && std_equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class K, class V, size_t N, class Compare>
+bool operator!=(const std_flat_map<K, V, N, Compare>& lhs, const std_flat_map<K, V, N, Compare>& rhs)
+{	// Returns `true' if the contents of two containers are not equal, else returns `false'.
+	return !(lhs == rhs);
+}
+
+// Erases all elements satisfying predicate `p' from container `c'.
+template<class K, class V, size_t N, class Compare, class UnaryPredicate>
+typename std_flat_map<K, V, N, Compare>::size_type std_erase_if(std_flat_map<K, V, N, Compare>& c, UnaryPredicate p)
+{
+	typename std_flat_map<K, V, N, Compare>::size_type n = 0;
+
+	for (typename std_flat_map<K, V, N, Compare>::iterator it = c.begin(); it != c.end();)
+	{
+		if (p(*it))
+		{
+			it = c.erase(it);
+			++n;
+		}
+		else
+			++it;
+	}
+
+	return n;
+}
+
+#pragma endregion
+
+#endif // !defined FLAT_MAP_H__
@@ -53,6 +53,9 @@
 #define FUNCTIONAL_H__ 20210609L
 
 #include <stddef.h>
+#include <assert.h>
+#include "type_traits.h"
+#include "uninitialized.h"
 
 template<class T>
 struct std_divides 
@@ -189,4 +192,261 @@ struct std_plus
 	}
 };
 
+// Hash function object for integral, enumeration and pointer types. The 
+// value itself is the hash, which is well distributed for the small, dense 
+// keys (ids, enumerators, characters) typical of embedded lookup tables.
+template<class T>
+struct std_hash
+{
+	size_t operator()(const T &key) const 
+	{
+		return static_cast<size_t>(key);
+	}
+};
+
+template<class T>
+struct std_hash<T*>
+{
+	size_t operator()(T* key) const 
+	{	// Fold in higher bits; the low-order bits of aligned objects are zero.
+		size_t h = reinterpret_cast<size_t>(key);
+
+		return h ^ (h >> 3);
+	}
+};
+
+// Type-erased wrapper for any callable object with signature `Signature' 
+// whose size is at most `Capacity' bytes. The callable is stored inline, never 
+// on the heap, and is invoked with a single indirect call, so an inplace 
+// function costs little more than a function pointer but can hold lambdas 
+// with captures, function objects and bound member functions:
+//
+//		std_inplace_function<void(int)> f = [&count](int n) { count += n; };
+//		std_inplace_function<void()> g(&display, &Display::refresh);
+//
+// Callables must be copy constructible. Storing one larger than `Capacity' 
+// is a compile-time error.
+template<class Signature, size_t Capacity = 4 * sizeof(void*), size_t Align = alignof(max_align_t)>
+class std_inplace_function;
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+class std_inplace_function<R(Args...), Capacity, Align>
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_inplace_function<R(Args...), Capacity, Align> self_type;
+	typedef R result_type;
+
+private:
+	typedef typename std_aligned_storage<Capacity, Align>::type storage_type;
+	// Calls the callable stored at `obj'.
+	typedef R(*invoke_type)(void* obj, Args&&...);
+	// Copies or moves the callable at `src' into `dest', or destroys it if `dest' is null.
+	typedef void(*manage_type)(void* dest, void* src, bool move);
+
+	template<class F>
+	struct Ops
+	{
+		static R invoke(void* obj, Args&&... args) 
+		{ 
+			return (*static_cast<F*>(obj))(std_forward<Args>(args)...); 
+		}
+		static void manage(void* dest, void* src, bool move)
+		{
+			if (!dest)
+				std_destroy_at(static_cast<F*>(src));
+			else if (move)
+				std_construct_at(static_cast<F*>(dest), std_move(*static_cast<F*>(src)));
+			else
+				std_construct_at(static_cast<F*>(dest), *static_cast<const F*>(src));
+		}
+	};
+
+	// Binds an object and one of its member functions.
+	template<class Obj, class Fn>
+	struct Bound
+	{
+		Obj* obj_;
+		Fn fn_;
+
+		R operator()(Args... args) const { return (obj_->*fn_)(std_forward<Args>(args)...); }
+	};
+
+public:		/**** Ctors ****/
+	std_inplace_function() : invoke_(), manage_() {}
+	std_inplace_function(decltype(nullptr)) : invoke_(), manage_() {}
+	template<class F, class = typename std_enable_if<!std_is_same<typename std_decay<F>::type, self_type>::value>::type>
+	std_inplace_function(F&&);
+	template<class Obj>
+	std_inplace_function(Obj*, R(Obj::*)(Args...));
+	template<class Obj>
+	std_inplace_function(const Obj*, R(Obj::*)(Args...) const);
+	std_inplace_function(const self_type&);
+	std_inplace_function(self_type&&);
+	~std_inplace_function() { reset(); }
+
+	self_type& operator=(const self_type&);
+	self_type& operator=(self_type&&);
+	self_type& operator=(decltype(nullptr)) { reset(); return *this; }
+	template<class F, class = typename std_enable_if<!std_is_same<typename std_decay<F>::type, self_type>::value>::type>
+	self_type& operator=(F&& f) { return *this = self_type(std_forward<F>(f)); }
+
+public:		/**** Member Functions ****/
+	// Invokes the stored callable, which must not be empty.
+	R			operator()(Args... args) const;
+	explicit	operator bool() const { return invoke_ != nullptr; }
+	void		swap(self_type&);
+
+private:
+	template<class F>
+	void		store(F&&);
+	void		reset();
+
+private:	/**** Member Objects ****/
+	mutable storage_type	storage_;	// Inline callable storage.
+	invoke_type				invoke_;	// Calls the callable, null if empty.
+	manage_type				manage_;	// Copies, moves or destroys the callable, null if trivial.
+};
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+template<class F, class>
+std_inplace_function<R(Args...), Capacity, Align>::std_inplace_function(F&& f) : invoke_(), manage_()
+{
+	store(std_forward<F>(f));
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+template<class Obj>
+std_inplace_function<R(Args...), Capacity, Align>::std_inplace_function(Obj* obj, R(Obj::*fn)(Args...)) : 
+	invoke_(), manage_()
+{
+	Bound<Obj, R(Obj::*)(Args...)> bound = { obj, fn };
+
+	store(bound);
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+template<class Obj>
+std_inplace_function<R(Args...), Capacity, Align>::std_inplace_function(const Obj* obj, R(Obj::*fn)(Args...) const) : 
+	invoke_(), manage_()
+{
+	Bound<const Obj, R(Obj::*)(Args...) const> bound = { obj, fn };
+
+	store(bound);
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+std_inplace_function<R(Args...), Capacity, Align>::std_inplace_function(const self_type& other) : 
+	invoke_(other.invoke_), manage_(other.manage_)
+{
+	if (manage_)
+		manage_(&storage_, &other.storage_, false);
+	else
+		storage_ = other.storage_;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+std_inplace_function<R(Args...), Capacity, Align>::std_inplace_function(self_type&& other) : 
+	invoke_(other.invoke_), manage_(other.manage_)
+{
+	if (manage_)
+		manage_(&storage_, &other.storage_, true);
+	else
+		storage_ = other.storage_;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+std_inplace_function<R(Args...), Capacity, Align>& 
+	std_inplace_function<R(Args...), Capacity, Align>::operator=(const self_type& other)
+{
+	if (this != &other)
+	{
+		reset();
+		if (other.manage_)
+			other.manage_(&storage_, &other.storage_, false);
+		else
+			storage_ = other.storage_;
+		invoke_ = other.invoke_;
+		manage_ = other.manage_;
+	}
+
+	return *this;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+std_inplace_function<R(Args...), Capacity, Align>& 
+	std_inplace_function<R(Args...), Capacity, Align>::operator=(self_type&& other)
+{
+	if (this != &other)
+	{
+		reset();
+		if (other.manage_)
+			other.manage_(&storage_, &other.storage_, true);
+		else
+			storage_ = other.storage_;
+		invoke_ = other.invoke_;
+		manage_ = other.manage_;
+	}
+
+	return *this;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+R std_inplace_function<R(Args...), Capacity, Align>::operator()(Args... args) const
+{
+	assert(invoke_);
+
+	return invoke_(&storage_, std_forward<Args>(args)...);
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+void std_inplace_function<R(Args...), Capacity, Align>::swap(self_type& other)
+{
+	self_type tmp(std_move(other));
+
+	other = std_move(*this);
+	*this = std_move(tmp);
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+template<class F>
+void std_inplace_function<R(Args...), Capacity, Align>::store(F&& f)
+{
+	typedef typename std_decay<F>::type callable_type;
+
+	static_assert(sizeof(callable_type) <= Capacity, "std_inplace_function callable exceeds capacity.");
+	static_assert(Align % alignof(callable_type) == 0, "std_inplace_function callable alignment unsupported.");
+
+	std_construct_at(reinterpret_cast<callable_type*>(&storage_), std_forward<F>(f));
+	invoke_ = &Ops<callable_type>::invoke;
+	// Trivial callables, e.g. function pointers and by-reference captures, are copied bytewise.
+	manage_ = std_is_trivially_copyable<callable_type>::value ? nullptr : &Ops<callable_type>::manage;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+void std_inplace_function<R(Args...), Capacity, Align>::reset()
+{
+	if (manage_)
+		manage_(nullptr, &storage_, false);
+	invoke_ = nullptr;
+	manage_ = nullptr;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+bool operator==(const std_inplace_function<R(Args...), Capacity, Align>& f, decltype(nullptr))
+{	// Returns `true' if `f' is empty, else returns `false'.
+	return !f;
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+bool operator!=(const std_inplace_function<R(Args...), Capacity, Align>& f, decltype(nullptr))
+{	// Returns `true' if `f' is not empty, else returns `false'.
+	return static_cast<bool>(f);
+}
+
+template<class R, class... Args, size_t Capacity, size_t Align>
+void swap(std_inplace_function<R(Args...), Capacity, Align>& lhs, std_inplace_function<R(Args...), Capacity, Align>& rhs)
+{	// Swap the contents of two inplace functions.
+	lhs.swap(rhs);
+}
+
 #endif // !defined FUNCTIONAL_H__
\ No newline at end of file
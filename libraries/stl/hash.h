@@ -0,0 +1,170 @@
+/*
+ *	This file defines compile-time and incremental string hash functions.
+ *
+ *	***************************************************************************
+ *
+ *	File: hash.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines string hash functions that are not part of the
+ *		C++ Standard Template Library (STL), for comparing strings such as
+ *		command keys and names as integers: the 32-bit FNV-1a hash and the
+ *		16-bit CRC-16/CCITT-FALSE checksum.
+ *
+ *		All hash functions are `constexpr', so hashes of string literals
+ *		cost nothing at run time and can be used as `case' labels. The
+ *		`_hash' literal suffix returns the FNV-1a hash of a string literal:
+ *
+ *			switch (std_fnv1a(key.data(), key.size()))
+ *			{
+ *			case "start"_hash:
+ *				...
+ *			}
+ *
+ *		Each hash also has an update function that folds in one more char,
+ *		and `std_fnv1a_hasher' and `std_crc16_hasher' apply them
+ *		incrementally, so a string can be hashed as it arrives, for instance
+ *		byte by byte from a serial port, without buffering it first. The
+ *		hash of a string computed incrementally equals the hash of the whole
+ *		string.
+ *
+ *		Equal strings always have equal hashes, but unequal strings may too,
+ *		so a matching hash must be confirmed by comparing the strings.
+ *
+ *		The `constexpr' functions are recursive, as C++11 requires, and are
+ *		meant for compile-time use and short strings. Hashing at run time
+ *		should use the hashers.
+ *
+ *	**************************************************************************/
+
+#if !defined HASH_H__
+# define HASH_H__ 20261018L
+
+# include <stddef.h>			// `size_t'.
+# include <stdint.h>			// Fixed-width integral types.
+
+# pragma region std_fnv1a
+
+// FNV-1a hash constants.
+const uint32_t std_fnv1a_basis = 2166136261UL;
+const uint32_t std_fnv1a_prime = 16777619UL;
+
+// Returns the FNV-1a hash `h' updated with the char `c'.
+constexpr uint32_t std_fnv1a_update(uint32_t h, char c)
+{
+	return (h ^ static_cast<uint8_t>(c)) * std_fnv1a_prime;
+}
+
+// Returns the FNV-1a hash of `n' chars starting at `s', continuing from the hash `h'.
+constexpr uint32_t std_fnv1a(const char* s, size_t n, uint32_t h = std_fnv1a_basis)
+{
+	return n == 0 ? h : std_fnv1a(s + 1, n - 1, std_fnv1a_update(h, *s));
+}
+
+// Returns the FNV-1a hash of a string literal.
+constexpr uint32_t operator"" _hash(const char* s, size_t n)
+{
+	return std_fnv1a(s, n);
+}
+
+// Incremental FNV-1a hasher.
+class std_fnv1a_hasher
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint32_t value_type;
+
+public:		/**** Ctors ****/
+	std_fnv1a_hasher() : value_(std_fnv1a_basis) {}
+
+public:		/**** Member Functions ****/
+	// Folds a char into the hash.
+	void		update(char c) { value_ = std_fnv1a_update(value_, c); }
+	// Folds `n' chars starting at `s' into the hash.
+	void		update(const char* s, size_t n) { while (n--) update(*s++); }
+	// Returns the hash of all chars folded in since construction or the last reset.
+	value_type	value() const { return value_; }
+	// Restarts the hash.
+	void		reset() { value_ = std_fnv1a_basis; }
+
+private:	/**** Member Objects ****/
+	value_type	value_;	// The current hash.
+};
+
+# pragma endregion
+
+# pragma region std_crc16
+
+namespace
+{
+	// Returns the CRC `crc' shifted `bits' times, with the polynomial applied.
+	constexpr uint16_t std_crc16_shift(uint16_t crc, unsigned bits)
+	{
+		return bits == 0 ? crc : std_crc16_shift(crc & 0x8000U ?
+			static_cast<uint16_t>((crc << 1) ^ 0x1021U) : static_cast<uint16_t>(crc << 1), bits - 1);
+	}
+}
+
+// CRC-16/CCITT-FALSE initial value.
+const uint16_t std_crc16_init = 0xFFFFU;
+
+// Returns the CRC-16/CCITT-FALSE checksum `crc' updated with the char `c'.
+constexpr uint16_t std_crc16_update(uint16_t crc, char c)
+{
+	return std_crc16_shift(crc ^ static_cast<uint16_t>(static_cast<uint8_t>(c) << 8), 8);
+}
+
+// Returns the CRC-16/CCITT-FALSE checksum of `n' chars starting at `s', continuing from `crc'.
+constexpr uint16_t std_crc16(const char* s, size_t n, uint16_t crc = std_crc16_init)
+{
+	return n == 0 ? crc : std_crc16(s + 1, n - 1, std_crc16_update(crc, *s));
+}
+
+// Incremental CRC-16/CCITT-FALSE hasher.
+class std_crc16_hasher
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint16_t value_type;
+
+public:		/**** Ctors ****/
+	std_crc16_hasher() : value_(std_crc16_init) {}
+
+public:		/**** Member Functions ****/
+	// Folds a char into the checksum.
+	void		update(char c) { value_ = std_crc16_update(value_, c); }
+	// Folds `n' chars starting at `s' into the checksum.
+	void		update(const char* s, size_t n) { while (n--) update(*s++); }
+	// Returns the checksum of all chars folded in since construction or the last reset.
+	value_type	value() const { return value_; }
+	// Restarts the checksum.
+	void		reset() { value_ = std_crc16_init; }
+
+private:	/**** Member Objects ****/
+	value_type	value_;	// The current checksum.
+};
+
+# pragma endregion
+
+#endif // !defined HASH_H__
@@ -34,6 +34,10 @@
  *		a C++ Standard Template Library (STL) implementation. The functions 
  *		behave according to the ISO C++11 Standard:	(ISO/IEC 14882:2011).
  *
+ *		As extensions, the file also defines streaming filters for sensor 
+ *		and ADC samples: `std_moving_average', `std_iir_filter', 
+ *		`std_median_filter' and `std_cic_decimator'.
+ *
  *		The Standard requires that STL objects reside in the `std' namespace.
  *		However, because later implementations of the Arduino IDE lack
  *		namespace support, this entire library resides in the global namespace
@@ -52,7 +56,10 @@
 #if !defined NUMERIC_H__
 # define NUMERIC_H__ 20210609L
 
+# include <stddef.h>		// `size_t'.
+# include <stdint.h>		// `int32_t'.
 # include "iterator.h"
+# include "type_traits.h"	// `std_make_unsigned'.
 
 template<class InputIt, class T>
 T std_accumulate(InputIt first, InputIt last, T init)
@@ -179,4 +186,293 @@ OutputIt std_partial_sum(InputIt first, InputIt last, OutputIt d_first, BinaryOp
     return ++d_first;
 }
 
+/*
+ * Streaming filters.
+ *
+ * These are not part of the Standard. Each filter object is a function 
+ * object that takes one sample at a time and returns the filtered value, 
+ * keeping all of its state in fixed-size member arrays, so nothing is ever 
+ * allocated. Each also has a batch overload that filters the range 
+ * [first, last) into `d_first' and returns the end of the output range. 
+ * The batch loop over contiguous arrays is unrolled by four.
+ */
+
+namespace
+{
+    // Filters the range [first, last) one sample at a time.
+    template<class Filter, class InputIt, class OutputIt>
+    OutputIt std_filter_apply(Filter& filter, InputIt first, InputIt last, OutputIt d_first)
+    {
+        for (; first != last; ++first, ++d_first)
+            *d_first = filter(*first);
+
+        return d_first;
+    }
+
+    // Filters the array [first, last) one sample at a time, four samples per iteration.
+    template<class Filter, class T, class U>
+    U* std_filter_apply(Filter& filter, T* first, T* last, U* d_first)
+    {
+        size_t n = static_cast<size_t>(last - first);
+
+        for (; n >= 4; n -= 4, first += 4, d_first += 4)
+        {
+            d_first[0] = filter(first[0]);
+            d_first[1] = filter(first[1]);
+            d_first[2] = filter(first[2]);
+            d_first[3] = filter(first[3]);
+        }
+        for (; n != 0; --n)
+            *d_first++ = filter(*first++);
+
+        return d_first;
+    }
+
+    // Returns `base' raised to the power `exp'.
+    template<class T>
+    constexpr T std_ipow(T base, unsigned exp)
+    {
+        return exp == 0 ? T(1) : base * std_ipow(base, exp - 1);
+    }
+}
+
+// Boxcar moving average of the last `N' samples, summed in type `Acc'.
+template<class T, size_t N, class Acc = T>
+class std_moving_average
+{
+    static_assert(N > 0, "std_moving_average window must not be empty.");
+
+public:
+    typedef T value_type;
+    typedef Acc accumulator_type;
+    typedef size_t size_type;
+
+public:
+    std_moving_average() : window_(), sum_(), pos_(), count_() {}
+
+public:
+    // Adds a sample and returns the average of the window.
+    value_type operator()(value_type x)
+    {
+        // The running sum makes each sample O(1) regardless of the window size.
+        sum_ += x;
+        if (count_ == N)
+            sum_ -= window_[pos_];
+        else
+            ++count_;
+        window_[pos_] = x;
+        if (++pos_ == N)
+            pos_ = 0;
+
+        return value();
+    }
+
+    template<class InputIt, class OutputIt>
+    OutputIt operator()(InputIt first, InputIt last, OutputIt d_first)
+    {
+        return std_filter_apply(*this, first, last, d_first);
+    }
+
+    // Returns the average of the samples in the window, dividing by a constant once it's full.
+    value_type value() const
+    {
+        return count_ == N ? value_type(sum_ / Acc(N)) : count_ ? value_type(sum_ / Acc(count_)) : value_type();
+    }
+
+    size_type size() const { return count_; }
+    static constexpr size_type capacity() { return N; }
+    bool full() const { return count_ == N; }
+    void reset() { sum_ = Acc(); pos_ = count_ = 0; }
+
+private:
+    value_type          window_[N]; // The last `N' samples, oldest at `pos_' once full.
+    accumulator_type    sum_;       // Sum of the samples in the window.
+    size_type           pos_;       // Next write position.
+    size_type           count_;     // Number of samples in the window.
+};
+
+// First-order low-pass IIR filter, y += (x - y) / 2^Shift, with `Shift' extra fraction bits of state in type `Acc'.
+template<class T, unsigned Shift, class Acc = long>
+class std_iir_filter
+{
+    static_assert(Shift > 0 && Shift < sizeof(Acc) * 8 - 1, "std_iir_filter shift out of range.");
+
+public:
+    typedef T value_type;
+    typedef Acc accumulator_type;
+
+    static constexpr Acc One = Acc(1) << Shift;
+
+public:
+    std_iir_filter() : state_(), primed_() {}
+
+public:
+    // Adds a sample and returns the filtered value.
+    value_type operator()(value_type x)
+    {
+        // Start from the first sample rather than ramping up from zero.
+        if (!primed_)
+        {
+            state_ = Acc(x) * One;
+            primed_ = true;
+        }
+        else
+            state_ += Acc(x) - rounded();   // Feeding back the rounded output lets it settle on `x'.
+
+        return value();
+    }
+
+    template<class InputIt, class OutputIt>
+    OutputIt operator()(InputIt first, InputIt last, OutputIt d_first)
+    {
+        return std_filter_apply(*this, first, last, d_first);
+    }
+
+    // Returns the filtered value, rounded to nearest.
+    value_type value() const { return value_type(rounded()); }
+    void reset() { state_ = Acc(); primed_ = false; }
+
+private:
+    Acc rounded() const { return (state_ + (One >> 1)) >> Shift; }
+
+private:
+    accumulator_type    state_;     // Filtered value scaled by 2^Shift.
+    bool                primed_;    // Whether the first sample has been seen.
+};
+
+template<class T, unsigned Shift, class Acc>
+constexpr Acc std_iir_filter<T, Shift, Acc>::One;
+
+// Median of the last `N' samples, for small odd `N'.
+template<class T, size_t N>
+class std_median_filter
+{
+    static_assert(N % 2 == 1, "std_median_filter window must be odd.");
+
+public:
+    typedef T value_type;
+    typedef size_t size_type;
+
+public:
+    std_median_filter() : window_(), sorted_(), pos_(), count_() {}
+
+public:
+    // Adds a sample and returns the median of the window.
+    value_type operator()(value_type x)
+    {
+        size_type i;
+
+        // Once full, the new sample takes the oldest one's place in the sorted 
+        // copy and is moved into order, which is a single O(N) pass.
+        if (count_ == N)
+        {
+            for (i = 0; sorted_[i] != window_[pos_]; ++i)
+                ;
+        }
+        else
+            i = count_++;
+        for (; i > 0 && x < sorted_[i - 1]; --i)
+            sorted_[i] = sorted_[i - 1];
+        for (; i + 1 < count_ && sorted_[i + 1] < x; ++i)
+            sorted_[i] = sorted_[i + 1];
+        sorted_[i] = x;
+        window_[pos_] = x;
+        if (++pos_ == N)
+            pos_ = 0;
+
+        return value();
+    }
+
+    template<class InputIt, class OutputIt>
+    OutputIt operator()(InputIt first, InputIt last, OutputIt d_first)
+    {
+        return std_filter_apply(*this, first, last, d_first);
+    }
+
+    // Returns the median of the samples in the window.
+    value_type value() const { return count_ ? sorted_[(count_ - 1) / 2] : value_type(); }
+    size_type size() const { return count_; }
+    static constexpr size_type capacity() { return N; }
+    bool full() const { return count_ == N; }
+    void reset() { pos_ = count_ = 0; }
+
+private:
+    value_type  window_[N]; // The last `N' samples, oldest at `pos_' once full.
+    value_type  sorted_[N]; // The samples in the window, in ascending order.
+    size_type   pos_;       // Next write position.
+    size_type   count_;     // Number of samples in the window.
+};
+
+// Cascaded integrator-comb decimator of order `Order' that outputs one sample per `R' inputs.
+template<class T, unsigned Order, unsigned R, class Acc = int32_t>
+class std_cic_decimator
+{
+    static_assert(Order > 0 && R > 0, "std_cic_decimator order and rate must be positive.");
+
+public:
+    typedef T value_type;
+    typedef Acc accumulator_type;
+    // Registers wrap around, which the comb stages undo as long as `Acc' can 
+    // hold the input bits plus Order * log2(R) bits of gain.
+    typedef typename std_make_unsigned<Acc>::type register_type;
+
+public:
+    std_cic_decimator() : integrators_(), delays_(), phase_(), out_() {}
+
+public:
+    // Adds a sample and returns true if an output sample is ready.
+    bool operator()(value_type x)
+    {
+        integrators_[0] += register_type(x);
+        for (unsigned i = 1; i < Order; ++i)
+            integrators_[i] += integrators_[i - 1];
+        if (++phase_ < R)
+            return false;
+        phase_ = 0;
+        comb();
+
+        return true;
+    }
+
+    // Decimates [first, last) into `d_first', which receives one sample per `R' inputs.
+    template<class InputIt, class OutputIt>
+    OutputIt operator()(InputIt first, InputIt last, OutputIt d_first)
+    {
+        for (; first != last; ++first)
+            if ((*this)(*first))
+                *d_first++ = value();
+
+        return d_first;
+    }
+
+    // Returns the last output sample, scaled by the filter's DC gain.
+    accumulator_type raw() const { return out_; }
+    // Returns the last output sample at unity gain.
+    value_type value() const { return value_type(out_ / gain()); }
+    // Returns the filter's DC gain, R^Order.
+    static constexpr accumulator_type gain() { return std_ipow(Acc(R), Order); }
+    void reset() { *this = std_cic_decimator(); }
+
+private:
+    void comb()
+    {
+        register_type y = integrators_[Order - 1];
+
+        for (unsigned i = 0; i < Order; ++i)
+        {
+            register_type t = y;
+
+            y -= delays_[i];
+            delays_[i] = t;
+        }
+        out_ = accumulator_type(y);
+    }
+
+private:
+    register_type       integrators_[Order];    // Integrator stages.
+    register_type       delays_[Order];         // Comb stage delay lines.
+    unsigned            phase_;                 // Inputs since the last output.
+    accumulator_type    out_;                   // Last output sample, scaled by `gain()'.
+};
+
 #endif // !defined NUMERIC_H__
@@ -907,4 +907,47 @@ public:
 };
 # endif
 
-#endif // !defined NUMERIC_LIMITS_H__
\ No newline at end of file
+// Fixed-point type forward decl, see <fixed.h>.
+template<int IntBits, int FracBits, class Overflow> class std_fixed;
+
+template<int IntBits, int FracBits, class Overflow> class std_numeric_limits<std_fixed<IntBits, FracBits, Overflow>>
+{
+	typedef std_fixed<IntBits, FracBits, Overflow> T;
+
+public:
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = FracBits == 0;
+	static constexpr bool is_exact = true;
+	static constexpr bool has_infinity = false;
+	static constexpr bool has_quiet_NaN = false;
+	static constexpr bool has_signaling_NaN = false;
+	static constexpr std_float_denorm_style has_denorm = std_denorm_absent;
+	static constexpr bool has_denorm_loss = false;
+	static constexpr std_float_round_style round_style = std_round_to_nearest;
+	static constexpr bool is_iec559 = false;
+	static constexpr bool is_bounded = true;
+	static constexpr bool is_modulo = !Overflow::saturating;
+	static constexpr int digits = IntBits + FracBits - 1;
+	static constexpr int digits10 = digits * M_LOG10_2;
+	static constexpr int max_digits10 = 0;
+	static constexpr int radix = 2;
+	static constexpr int min_exponent = 0;
+	static constexpr int min_exponent10 = 0;
+	static constexpr int max_exponent = 0;
+	static constexpr int max_exponent10 = 0;
+	static constexpr bool traps = false;
+	static constexpr bool tinyness_before = false;
+	// Smallest positive value if there are fraction bits, as for floating-point types, else most negative.
+	static constexpr T min() noexcept { return T::from_raw(FracBits ? 1 : T::RawMin); }
+	static constexpr T lowest() noexcept { return T::from_raw(T::RawMin); }
+	static constexpr T max() noexcept { return T::from_raw(T::RawMax); }
+	static constexpr T epsilon() noexcept { return T::from_raw(1); }
+	static constexpr T round_error() noexcept { return T::from_raw(FracBits ? T::One >> 1 : 0); }
+	static constexpr T infinity() noexcept { return T(); }
+	static constexpr T quiet_NaN() noexcept { return T(); }
+	static constexpr T signaling_NaN() noexcept { return T(); }
+	static constexpr T denorm_min() noexcept { return T(); }
+};
+
+#endif // !defined NUMERIC_LIMITS_H__
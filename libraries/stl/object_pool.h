@@ -0,0 +1,302 @@
+/*
+ *	This file defines a fixed-capacity C++ Standard Template Library (STL)
+ *	style object pool.
+ *
+ *	***************************************************************************
+ *
+ *	File: object_pool.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_object_pool' class, which is not part of
+ *		the Standard. It manages `N' statically allocated, uninitialized
+ *		blocks, each large enough to hold one `T' object. Free blocks are
+ *		linked through their own storage, so `allocate()' and `deallocate()'
+ *		take constant time, cost no memory beyond one pointer and two
+ *		bitmaps, of allocated blocks and of constructed objects, and can
+ *		never fragment.
+ *
+ *		Blocks can be managed by hand with `create()' and `destroy()', or
+ *		through a `handle', a move-only owner that returns its object to the
+ *		pool when it goes out of scope. Objects still in the pool when it is
+ *		destroyed are destroyed with it, but blocks obtained from
+ *		`allocate()' are raw storage and are left alone:
+ *
+ *			std_object_pool<event_type, 16> pool;
+ *			std_object_pool<event_type, 16>::handle e = pool.acquire("Open", 2000UL);
+ *			if (e)
+ *				e->duration_ = 5000UL;
+ *
+ *		The pool keeps usage statistics: the number of blocks in use, the
+ *		largest number ever in use (high-water mark) and the number of
+ *		requests that failed because the pool was exhausted. A failed
+ *		request returns a null pointer or an empty handle.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined OBJECT_POOL_H__
+# define OBJECT_POOL_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stdint.h>			// `uintptr_t'.
+# include "type_traits.h"		// `std_aligned_storage'.
+# include "utility.h"			// `std_forward()', `std_swap()'.
+# include "uninitialized.h"		// `std_construct_at()', `std_destroy_at()'.
+# include "bitset.h"			// `std_bitset'.
+
+# pragma region std_object_pool
+
+// Fixed-capacity pool of `T' objects.
+template<class T, size_t N>
+class std_object_pool
+{
+	static_assert(N > 0, "std_object_pool capacity must be greater than zero.");
+
+public:		/**** Member Types and Constants ****/
+	typedef std_object_pool<T, N> self_type;
+	typedef T value_type;
+	typedef size_t size_type;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+
+	// Move-only owner of a pooled object, which is destroyed when the owner is.
+	class handle
+	{
+		friend class std_object_pool;
+
+	public:
+		handle() : pool_(), ptr_() {}
+		handle(const handle&) = delete;
+		handle(handle&& other) : pool_(other.pool_), ptr_(other.ptr_) { other.ptr_ = nullptr; }
+		~handle() { reset(); }
+		handle& operator=(const handle&) = delete;
+		handle& operator=(handle&& other) { if (this != &other) { reset(); pool_ = other.pool_; ptr_ = other.ptr_; other.ptr_ = nullptr; } return *this; }
+
+	public:
+		pointer get() const { return ptr_; }
+		reference operator*() const { return *ptr_; }
+		pointer operator->() const { return ptr_; }
+		explicit operator bool() const { return ptr_ != nullptr; }
+		// Gives up ownership of the object without destroying it and returns its address.
+		pointer release() { pointer p = ptr_; ptr_ = nullptr; return p; }
+		// Destroys the owned object, if any, and returns its block to the pool.
+		void reset() { if (ptr_) { pool_->destroy(ptr_); ptr_ = nullptr; } }
+		void swap(handle& other) { std_swap(pool_, other.pool_); std_swap(ptr_, other.ptr_); }
+
+	private:
+		handle(self_type* pool, pointer ptr) : pool_(pool), ptr_(ptr) {}
+
+	private:
+		self_type*	pool_;	// Owning pool.
+		pointer		ptr_;	// Owned object.
+	};
+
+public:		/**** Ctors ****/
+	std_object_pool();
+	std_object_pool(const self_type&) = delete;
+	~std_object_pool();
+
+	self_type& operator=(const self_type&) = delete;
+
+public:		/**** Member Functions ****/
+	// Returns an uninitialized block, or a null pointer if the pool is exhausted.
+	pointer					allocate();
+	// Returns the uninitialized block `p', obtained from `allocate()', to the pool.
+	void					deallocate(pointer);
+	// Constructs an object from `args' and returns its address, or a null pointer if the pool is exhausted.
+	template<class... Args>
+	pointer					create(Args&&...);
+	// Destroys the object at `p' and returns its block to the pool.
+	void					destroy(pointer);
+	// Constructs an object from `args' and returns a handle owning it, which is empty if the pool is exhausted.
+	template<class... Args>
+	handle					acquire(Args&&...);
+	// Checks whether `p' is a block allocated from this pool.
+	bool					owns(const_pointer) const;
+	size_type				size() const { return size_; }
+	size_type				available() const { return N - size_; }
+	static constexpr size_type capacity() { return N; }
+	bool					empty() const { return size_ == 0; }
+	bool					full() const { return size_ == N; }
+	// Returns the largest number of blocks ever in use.
+	size_type				high_water() const { return high_water_; }
+	// Returns the number of allocation requests that failed.
+	size_type				failures() const { return failures_; }
+	// Clears the failure count and restarts the high-water mark from the current use.
+	void					reset_stats() { high_water_ = size_; failures_ = 0; }
+
+private:
+	// A block either holds an object or links to the next free block.
+	union block_type
+	{
+		typename std_aligned_storage<sizeof(T), alignof(T)>::type storage;
+		block_type* next;
+	};
+
+	// Returns the index of the block holding `p', or `N' if `p' is not from this pool.
+	size_type				index_of(const_pointer) const;
+
+private:	/**** Member Objects ****/
+	block_type		blocks_[N];		// Block storage.
+	block_type*		free_;			// Head of the free list.
+	std_bitset<N>	live_;			// Allocated blocks.
+	std_bitset<N>	objects_;		// Blocks holding an object constructed by `create()'.
+	size_type		size_;			// Number of allocated blocks.
+	size_type		high_water_;	// Largest number of allocated blocks.
+	size_type		failures_;		// Number of failed allocations.
+};
+
+# pragma endregion
+
+#pragma region std_object_pool_ctors
+
+template<class T, size_t N>
+std_object_pool<T, N>::std_object_pool() :
+	free_(blocks_), live_(), objects_(), size_(), high_water_(), failures_()
+{
+	for (size_type i = 0; i < N - 1; ++i)
+		blocks_[i].next = &blocks_[i + 1];
+	blocks_[N - 1].next = nullptr;
+}
+
+template<class T, size_t N>
+std_object_pool<T, N>::~std_object_pool()
+{
+	// Destroy any objects left in the pool. Blocks from `allocate()' hold no object.
+	for (typename std_bitset<N>::const_iterator it = objects_.begin(); it != objects_.end(); ++it)
+		std_destroy_at(reinterpret_cast<pointer>(&blocks_[*it].storage));
+}
+
+#pragma endregion
+
+#pragma region std_object_pool_member_functions
+
+template<class T, size_t N>
+typename std_object_pool<T, N>::pointer std_object_pool<T, N>::allocate()
+{
+	if (!free_)
+	{
+		++failures_;
+		return nullptr;
+	}
+
+	block_type* block = free_;
+
+	free_ = block->next;
+	live_.set(static_cast<size_t>(block - blocks_));
+	if (++size_ > high_water_)
+		high_water_ = size_;
+
+	return reinterpret_cast<pointer>(&block->storage);
+}
+
+template<class T, size_t N>
+void std_object_pool<T, N>::deallocate(pointer p)
+{
+	size_type i = index_of(p);
+
+	assert(i < N && live_.test(i) && !objects_.test(i));
+	if (i == N || !live_.test(i) || objects_.test(i))
+		return;
+
+	live_.reset(i);
+	blocks_[i].next = free_;
+	free_ = &blocks_[i];
+	--size_;
+}
+
+template<class T, size_t N>
+template<class... Args>
+typename std_object_pool<T, N>::pointer std_object_pool<T, N>::create(Args&&... args)
+{
+	pointer p = allocate();
+
+	if (p)
+	{
+		std_construct_at(p, std_forward<Args>(args)...);
+		objects_.set(index_of(p));
+	}
+
+	return p;
+}
+
+template<class T, size_t N>
+void std_object_pool<T, N>::destroy(pointer p)
+{
+	if (!p)
+		return;
+
+	size_type i = index_of(p);
+
+	// Destroying twice, or destroying a foreign object, would run its destructor again.
+	assert(i < N && objects_.test(i));
+	if (i == N || !objects_.test(i))
+		return;
+
+	std_destroy_at(p);
+	objects_.reset(i);
+	deallocate(p);
+}
+
+template<class T, size_t N>
+template<class... Args>
+typename std_object_pool<T, N>::handle std_object_pool<T, N>::acquire(Args&&... args)
+{
+	return handle(this, create(std_forward<Args>(args)...));
+}
+
+template<class T, size_t N>
+bool std_object_pool<T, N>::owns(const_pointer p) const
+{
+	size_type i = index_of(p);
+
+	return i < N && live_.test(i);
+}
+
+template<class T, size_t N>
+typename std_object_pool<T, N>::size_type std_object_pool<T, N>::index_of(const_pointer p) const
+{
+	const block_type* block = reinterpret_cast<const block_type*>(p);
+
+	// Comparing unrelated pointers is unspecified, so test the range as integers.
+	uintptr_t addr = reinterpret_cast<uintptr_t>(block), first = reinterpret_cast<uintptr_t>(blocks_);
+
+	if (addr < first || addr >= first + sizeof(blocks_) || (addr - first) % sizeof(block_type) != 0)
+		return N;
+
+	return static_cast<size_type>((addr - first) / sizeof(block_type));
+}
+
+#pragma endregion
+
+#endif // !defined OBJECT_POOL_H__
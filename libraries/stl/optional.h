@@ -0,0 +1,286 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) optional value
+ *	type.
+ *
+ *	***************************************************************************
+ *
+ *	File: optional.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_optional' type from the C++17 <optional>
+ *		header of a C++ Standard Template Library (STL) implementation. An
+ *		optional either holds a value of type `T', stored inline with no
+ *		dynamic allocation, or holds nothing. It replaces sentinel values
+ *		such as `InvalidAngle' or `InvalidPin' with a type that says whether
+ *		the result is valid:
+ *
+ *			std_optional<angle_t> parseAngle(const char* s);
+ *			...
+ *			if (std_optional<angle_t> a = parseAngle(buf))
+ *				actuator.position(*a);
+ *
+ *		Since exceptions aren't available, accessing the value of an empty
+ *		optional is a precondition violation caught by `assert()' instead of
+ *		throwing `bad_optional_access'.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined OPTIONAL_H__
+# define OPTIONAL_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include "type_traits.h"		// `std_decay', `std_enable_if', `std_is_same'.
+# include "utility.h"			// `std_move()', `std_forward()', `std_in_place_t'.
+# include "uninitialized.h"		// `std_construct_at()', `std_destroy_at()'.
+
+// Tag type indicating an empty optional.
+struct std_nullopt_t { constexpr explicit std_nullopt_t(int) {} };
+constexpr std_nullopt_t std_nullopt(0);
+
+# pragma region std_optional
+
+// Type that may or may not hold a value of type `T'.
+template<class T>
+class std_optional
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_optional<T> self_type;
+	typedef T value_type;
+
+public:		/**** Ctors ****/
+	std_optional() : dummy_(), engaged_() {}
+	std_optional(std_nullopt_t) : dummy_(), engaged_() {}
+	std_optional(const self_type&);
+	std_optional(self_type&&);
+	template<class... Args>
+	explicit std_optional(std_in_place_t, Args&&... args) : dummy_(), engaged_() { emplace(std_forward<Args>(args)...); }
+	template<class U = T, class = typename std_enable_if<!std_is_same<typename std_decay<U>::type, self_type>::value &&
+		!std_is_same<typename std_decay<U>::type, std_in_place_t>::value>::type>
+	std_optional(U&& value) : dummy_(), engaged_() { emplace(std_forward<U>(value)); }
+	~std_optional() { reset(); }
+
+	self_type& operator=(std_nullopt_t) { reset(); return *this; }
+	self_type& operator=(const self_type&);
+	self_type& operator=(self_type&&);
+	template<class U = T, class = typename std_enable_if<!std_is_same<typename std_decay<U>::type, self_type>::value>::type>
+	self_type& operator=(U&&);
+
+public:		/**** Member Functions ****/
+	bool					has_value() const { return engaged_; }
+	explicit operator		bool() const { return engaged_; }
+	T&						value() { assert(engaged_); return value_; }
+	const T&				value() const { assert(engaged_); return value_; }
+	template<class U>
+	T						value_or(U&& default_value) const { return engaged_ ? value_ : static_cast<T>(std_forward<U>(default_value)); }
+	T&						operator*() { assert(engaged_); return value_; }
+	const T&				operator*() const { assert(engaged_); return value_; }
+	T*						operator->() { assert(engaged_); return &value_; }
+	const T*				operator->() const { assert(engaged_); return &value_; }
+	template<class... Args>
+	T&						emplace(Args&&...);
+	void					reset();
+	void					swap(self_type&);
+
+private:	/**** Member Objects ****/
+	union
+	{
+		char	dummy_;		// Active member while empty.
+		T		value_;		// The contained value.
+	};
+	bool		engaged_;	// Whether `value_' is alive.
+};
+
+# pragma endregion
+
+#pragma region std_optional_ctors
+
+template<class T>
+std_optional<T>::std_optional(const self_type& other) :
+	dummy_(), engaged_()
+{
+	if (other.engaged_)
+		emplace(other.value_);
+}
+
+template<class T>
+std_optional<T>::std_optional(self_type&& other) :
+	dummy_(), engaged_()
+{
+	if (other.engaged_)
+		emplace(std_move(other.value_));
+}
+
+template<class T>
+std_optional<T>& std_optional<T>::operator=(const self_type& other)
+{
+	if (this == &other)
+		;
+	else if (engaged_ && other.engaged_)
+		value_ = other.value_;
+	else if (other.engaged_)
+		emplace(other.value_);
+	else
+		reset();
+
+	return *this;
+}
+
+template<class T>
+std_optional<T>& std_optional<T>::operator=(self_type&& other)
+{
+	if (this == &other)
+		;
+	else if (engaged_ && other.engaged_)
+		value_ = std_move(other.value_);
+	else if (other.engaged_)
+		emplace(std_move(other.value_));
+	else
+		reset();
+
+	return *this;
+}
+
+template<class T>
+template<class U, class>
+std_optional<T>& std_optional<T>::operator=(U&& value)
+{
+	if (engaged_)
+		value_ = std_forward<U>(value);
+	else
+		emplace(std_forward<U>(value));
+
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region std_optional_member_functions
+
+template<class T>
+template<class... Args>
+T& std_optional<T>::emplace(Args&&... args)
+{
+	reset();
+	std_construct_at(&value_, std_forward<Args>(args)...);
+	engaged_ = true;
+
+	return value_;
+}
+
+template<class T>
+void std_optional<T>::reset()
+{
+	if (engaged_)
+	{
+		std_destroy_at(&value_);
+		engaged_ = false;
+	}
+}
+
+template<class T>
+void std_optional<T>::swap(self_type& other)
+{
+	if (engaged_ && other.engaged_)
+		std_swap(value_, other.value_);
+	else if (engaged_)
+	{
+		other.emplace(std_move(value_));
+		reset();
+	}
+	else if (other.engaged_)
+	{
+		emplace(std_move(other.value_));
+		other.reset();
+	}
+}
+
+#pragma endregion
+
+#pragma region std_optional_non-member_functions
+
+template<class T, class... Args>
+std_optional<T> std_make_optional(Args&&... args)
+{	// Returns an optional holding a `T' constructed from `args'.
+	return std_optional<T>(std_in_place, std_forward<Args>(args)...);
+}
+
+template<class T>
+std_optional<typename std_decay<T>::type> std_make_optional(T&& value)
+{	// Returns an optional holding `value'.
+	return std_optional<typename std_decay<T>::type>(std_forward<T>(value));
+}
+
+template<class T>
+bool operator==(const std_optional<T>& lhs, const std_optional<T>& rhs)
+{	// Returns true if both are empty or both hold equal values.
+	return bool(lhs) != bool(rhs) ? false : !lhs ? true : *lhs == *rhs;
+}
+
+template<class T>
+bool operator!=(const std_optional<T>& lhs, const std_optional<T>& rhs)
+{	// Returns true if one is empty and the other isn't, or they hold unequal values.
+	return !(lhs == rhs);
+}
+
+template<class T>
+bool operator==(const std_optional<T>& opt, std_nullopt_t)
+{	// Returns true if `opt' is empty.
+	return !opt;
+}
+
+template<class T>
+bool operator!=(const std_optional<T>& opt, std_nullopt_t)
+{	// Returns true if `opt' holds a value.
+	return bool(opt);
+}
+
+template<class T>
+bool operator==(const std_optional<T>& opt, const T& value)
+{	// Returns true if `opt' holds a value equal to `value'.
+	return opt && *opt == value;
+}
+
+template<class T>
+bool operator!=(const std_optional<T>& opt, const T& value)
+{	// Returns true if `opt' is empty or holds a value unequal to `value'.
+	return !(opt == value);
+}
+
+template<class T>
+void swap(std_optional<T>& lhs, std_optional<T>& rhs)
+{	// Swaps the contents of two optionals.
+	lhs.swap(rhs);
+}
+
+#pragma endregion
+
+#endif // !defined OPTIONAL_H__
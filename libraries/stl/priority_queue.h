@@ -0,0 +1,175 @@
+/*
+ *	This file defines a fixed-capacity C++ Standard Template Library (STL)
+ *	priority queue.
+ *
+ *	***************************************************************************
+ *
+ *	File: priority_queue.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_priority_queue' container adaptor from
+ *		the <queue> header of a C++ Standard Template Library (STL)
+ *		implementation. It keeps up to `N' elements in a binary heap stored
+ *		in a `std_static_vector', so `top()' takes constant time, `push()'
+ *		and `pop()' take O(log n) time and nothing is allocated dynamically.
+ *
+ *		As in the Standard, `top()' is the greatest element with respect to
+ *		`Compare', so a queue ordered by `std_greater' yields the smallest
+ *		element first, e.g. the earliest deadline:
+ *
+ *			std_priority_queue<msecs_t, 8, std_greater<msecs_t>> alarms;
+ *
+ *		Pushing onto a full queue is a precondition violation, which is
+ *		caught by `assert()' and otherwise ignored.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined PRIORITY_QUEUE_H__
+# define PRIORITY_QUEUE_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include "functional.h"		// `std_less'.
+# include "algorithm.h"			// Heap operations.
+# include "static_vector.h"		// `std_static_vector'.
+
+# pragma region std_priority_queue
+
+// Fixed-capacity priority queue.
+template<class T, size_t N, class Compare = std_less<T>>
+class std_priority_queue
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_priority_queue<T, N, Compare> self_type;
+	typedef std_static_vector<T, N> container_type;
+	typedef Compare value_compare;
+	typedef T value_type;
+	typedef size_t size_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+
+public:		/**** Ctors ****/
+	explicit std_priority_queue(const value_compare& comp = value_compare()) : c_(), comp_(comp) {}
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	std_priority_queue(InputIt, InputIt, const value_compare& = value_compare());
+
+public:		/**** Member Functions ****/
+	const_reference			top() const { return c_.front(); }
+	bool					empty() const { return c_.empty(); }
+	bool					full() const { return c_.full(); }
+	size_type				size() const { return c_.size(); }
+	static constexpr size_type capacity() { return N; }
+	void					push(const_reference);
+	void					push(value_type&&);
+	template<class... Args>
+	void					emplace(Args&&...);
+	void					pop();
+	void					clear() { c_.clear(); }
+	void					swap(self_type&);
+
+private:	/**** Member Objects ****/
+	container_type	c_;		// Heap storage.
+	value_compare	comp_;	// Heap ordering.
+};
+
+# pragma endregion
+
+#pragma region std_priority_queue_ctors
+
+template<class T, size_t N, class Compare>
+template<class InputIt, class>
+std_priority_queue<T, N, Compare>::std_priority_queue(InputIt first, InputIt last, const value_compare& comp) :
+	c_(), comp_(comp)
+{
+	for (; first != last && !c_.full(); ++first)
+		c_.push_back(*first);
+	std_make_heap(c_.begin(), c_.end(), comp_);
+}
+
+#pragma endregion
+
+#pragma region std_priority_queue_member_functions
+
+template<class T, size_t N, class Compare>
+void std_priority_queue<T, N, Compare>::push(const_reference value)
+{
+	emplace(value);
+}
+
+template<class T, size_t N, class Compare>
+void std_priority_queue<T, N, Compare>::push(value_type&& value)
+{
+	emplace(std_move(value));
+}
+
+template<class T, size_t N, class Compare>
+template<class... Args>
+void std_priority_queue<T, N, Compare>::emplace(Args&&... args)
+{
+	assert(!full());
+	if (full())
+		return;
+
+	c_.emplace_back(std_forward<Args>(args)...);
+	std_push_heap(c_.begin(), c_.end(), comp_);
+}
+
+template<class T, size_t N, class Compare>
+void std_priority_queue<T, N, Compare>::pop()
+{
+	assert(!empty());
+	if (empty())
+		return;
+
+	std_pop_heap(c_.begin(), c_.end(), comp_);
+	c_.pop_back();
+}
+
+template<class T, size_t N, class Compare>
+void std_priority_queue<T, N, Compare>::swap(self_type& other)
+{
+	c_.swap(other.c_);
+	std_swap(comp_, other.comp_);
+}
+
+#pragma endregion
+
+#pragma region std_priority_queue_non-member_functions
+
+template<class T, size_t N, class Compare>
+void swap(std_priority_queue<T, N, Compare>& lhs, std_priority_queue<T, N, Compare>& rhs)
+{	// Swap the contents of two containers.
+	lhs.swap(rhs);
+}
+
+#pragma endregion
+
+#endif // !defined PRIORITY_QUEUE_H__
@@ -0,0 +1,547 @@
+/*
+ *	This file defines fast pseudo-random number engines and distributions.
+ *
+ *	***************************************************************************
+ *
+ *	File: random.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines a subset of the C++ <random> header of a C++
+ *		Standard Template Library (STL) implementation. The Standard engines,
+ *		such as `mt19937', are too large or too slow for MCUs, so the engines
+ *		here are small, fast generators which are not part of the Standard,
+ *		though they meet its uniform random bit generator requirements:
+ *
+ *			std_xorshift32		- 4 bytes of state, 32-bit results. The
+ *								  fastest, good enough for jitter and
+ *								  backoff but fails some statistical tests.
+ *			std_pcg32			- 16 bytes of state, 32-bit results, with
+ *								  2^63 selectable streams. The best
+ *								  general-purpose choice on hosts. On AVR
+ *								  targets each result needs a 64-bit
+ *								  multiplication, which is slow.
+ *			std_xoroshiro128pp	- 16 bytes of state, 64-bit results. The
+ *								  fastest on 64-bit hosts.
+ *			std_splitmix64		- 8 bytes of state, 64-bit results. Used to
+ *								  expand seeds for the other engines.
+ *
+ *		All are seeded from a single 64-bit value, which is expanded with
+ *		SplitMix64 so that similar seeds, such as 1 and 2, give unrelated
+ *		sequences. None is suitable for cryptography.
+ *
+ *		The distributions turn engine results into values of the required
+ *		kind without floating-point arithmetic:
+ *
+ *			std_uniform_int_distribution	- integers uniform in [a, b], by
+ *											  Lemire's nearly-divisionless
+ *											  method, which needs a single
+ *											  multiplication and almost
+ *											  never divides.
+ *			std_bernoulli_distribution		- `true' with probability `p'.
+ *			std_uniform_fixed_distribution	- `std_fixed' values uniform in
+ *											  [a, b).
+ *
+ *		Ranges of 16-bit integer types, including the 16-bit `int' of AVR
+ *		targets, only need a 16x16-bit multiplication.
+ *
+ *		MCUs have no entropy source, so `std_noise_seed()' gathers a seed
+ *		from a noisy input, typically the analog input of an unconnected
+ *		pin, by mixing its samples with SplitMix64:
+ *
+ *			std_pcg32 rng(std_noise_seed([]() { return analogRead(A0); }));
+ *			std_uniform_int_distribution<uint16_t> backoff(50, 200);
+ *			...
+ *			delay(backoff(rng));
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined RANDOM_H__
+# define RANDOM_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <limits.h>			// `CHAR_BIT'.
+# include <stddef.h>			// `size_t'.
+# include <stdint.h>			// Fixed-width integral types.
+# include "type_traits.h"		// `std_conditional', `std_is_integral'.
+# include "numeric_limits.h"	// `std_numeric_limits'.
+
+namespace
+{
+	// Returns `x' rotated left by `k' bits.
+	inline uint64_t std_rotl64(uint64_t x, unsigned k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	// Returns `x' rotated right by `k' bits.
+	inline uint32_t std_rotr32(uint32_t x, unsigned k)
+	{
+		return (x >> k) | (x << ((32 - k) & 31));
+	}
+
+	// Returns the high bits of a result of `g', as many as there are in type `U'.
+	template<class U, class G>
+	inline U std_random_bits(G& g)
+	{
+		static_assert(G::min() == 0 && G::max() == typename G::result_type(-1),
+			"std_random_bits requires an engine whose results span all bits of its result type.");
+		static_assert(sizeof(U) <= sizeof(typename G::result_type), "engine result type too narrow.");
+
+		// The high bits are the better ones for some engines, notably `std_xorshift32'.
+		return static_cast<U>(g() >> (CHAR_BIT * (sizeof(typename G::result_type) - sizeof(U))));
+	}
+}
+
+# pragma region std_splitmix64
+
+// Golden ratio increment of the SplitMix64 generator.
+const uint64_t std_splitmix64_gamma = 0x9E3779B97F4A7C15ULL;
+
+// Returns the SplitMix64 finalizer of `z', a bijective 64-bit hash.
+inline uint64_t std_splitmix64_mix(uint64_t z)
+{
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+	return z ^ (z >> 31);
+}
+
+// SplitMix64 pseudo-random number engine.
+class std_splitmix64
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint64_t result_type;
+	static const result_type default_seed = 0;
+
+public:		/**** Ctors ****/
+	explicit std_splitmix64(uint64_t value = default_seed) : state_(value) {}
+
+public:		/**** Member Functions ****/
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+	void		seed(uint64_t value = default_seed) { state_ = value; }
+	result_type	operator()() { return std_splitmix64_mix(state_ += std_splitmix64_gamma); }
+	void		discard(unsigned long long n) { state_ += std_splitmix64_gamma * n; }
+
+private:	/**** Member Objects ****/
+	uint64_t	state_;	// The generator state.
+};
+
+# pragma endregion
+
+# pragma region std_xorshift32
+
+// Marsaglia's 32-bit xorshift pseudo-random number engine.
+class std_xorshift32
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint32_t result_type;
+	static const uint64_t default_seed = 0;
+
+public:		/**** Ctors ****/
+	explicit std_xorshift32(uint64_t value = default_seed) { seed(value); }
+
+public:		/**** Member Functions ****/
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT32_MAX; }
+	void		seed(uint64_t);
+	result_type	operator()();
+	void		discard(unsigned long long n) { while (n--) operator()(); }
+
+private:	/**** Member Objects ****/
+	uint32_t	state_;	// The generator state, never zero.
+};
+
+# pragma endregion
+
+# pragma region std_xoroshiro128pp
+
+// Blackman and Vigna's xoroshiro128++ pseudo-random number engine.
+class std_xoroshiro128pp
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint64_t result_type;
+	static const uint64_t default_seed = 0;
+
+public:		/**** Ctors ****/
+	explicit std_xoroshiro128pp(uint64_t value = default_seed) { seed(value); }
+
+public:		/**** Member Functions ****/
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+	void		seed(uint64_t);
+	result_type	operator()();
+	void		discard(unsigned long long n) { while (n--) operator()(); }
+	// Advances the engine by 2^64 results, giving a sequence that doesn't overlap this one.
+	void		jump();
+
+private:	/**** Member Objects ****/
+	uint64_t	state_[2];	// The generator state, never all zero.
+};
+
+# pragma endregion
+
+# pragma region std_pcg32
+
+// O'Neill's PCG32 (PCG-XSH-RR 64/32) pseudo-random number engine.
+class std_pcg32
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint32_t result_type;
+	static const uint64_t default_seed = 0x853C49E6748FEA9BULL;
+	static const uint64_t default_stream = 0xDA3E39CB94B95BDBULL;
+
+private:
+	static const uint64_t Multiplier = 6364136223846793005ULL;
+
+public:		/**** Ctors ****/
+	explicit std_pcg32(uint64_t value = default_seed, uint64_t stream = default_stream) { seed(value, stream); }
+
+public:		/**** Member Functions ****/
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT32_MAX; }
+	// Seeds the engine, engines with different `stream' values give unrelated sequences.
+	void		seed(uint64_t, uint64_t = default_stream);
+	result_type	operator()();
+	void		discard(unsigned long long);
+
+private:	/**** Member Objects ****/
+	uint64_t	state_;		// The generator state.
+	uint64_t	increment_;	// The stream selector, always odd.
+};
+
+# pragma endregion
+
+# pragma region std_uniform_int_distribution
+
+// Distribution of integers uniform in the closed range [a, b].
+template<class IntType = int>
+class std_uniform_int_distribution
+{
+	static_assert(std_is_integral<IntType>::value && sizeof(IntType) <= 4,
+		"std_uniform_int_distribution requires an integral type of at most 32 bits.");
+
+public:		/**** Member Types and Constants ****/
+	typedef IntType result_type;
+
+private:
+	// Unsigned type holding `b - a', and the type holding its products.
+	typedef typename std_conditional<(sizeof(IntType) <= 2), uint16_t, uint32_t>::type range_type;
+	typedef typename std_conditional<(sizeof(IntType) <= 2), uint32_t, uint64_t>::type wide_type;
+
+public:		/**** Ctors ****/
+	explicit std_uniform_int_distribution(result_type a = 0, result_type b = std_numeric_limits<IntType>::max()) :
+		a_(a), b_(b), range_(static_cast<range_type>(static_cast<range_type>(b) - static_cast<range_type>(a)))
+	{
+		assert(a <= b);
+	}
+
+public:		/**** Member Functions ****/
+	template<class G>
+	result_type			operator()(G&);
+	void				reset() {}
+	result_type			a() const { return a_; }
+	result_type			b() const { return b_; }
+	result_type			min() const { return a_; }
+	result_type			max() const { return b_; }
+
+private:	/**** Member Objects ****/
+	result_type	a_;		// The lower bound.
+	result_type	b_;		// The upper bound.
+	range_type	range_;	// The number of values less one.
+};
+
+# pragma endregion
+
+# pragma region std_bernoulli_distribution
+
+// Distribution of `bool' values that are `true' with probability `p'.
+class std_bernoulli_distribution
+{
+public:		/**** Member Types and Constants ****/
+	typedef bool result_type;
+
+public:		/**** Ctors ****/
+	explicit std_bernoulli_distribution(double = 0.5);
+	// Constructs a distribution with probability `numerator / denominator', without floating-point arithmetic.
+	std_bernoulli_distribution(uint32_t, uint32_t);
+
+public:		/**** Member Functions ****/
+	template<class G>
+	result_type		operator()(G& g) { return std_random_bits<uint32_t>(g) < threshold_ || certain_; }
+	void			reset() {}
+	double			p() const { return certain_ ? 1.0 : threshold_ / 4294967296.0; }
+	static constexpr result_type min() { return false; }
+	static constexpr result_type max() { return true; }
+
+private:	/**** Member Objects ****/
+	uint32_t	threshold_;	// The probability scaled by 2^32.
+	bool		certain_;	// Whether the probability is 1.
+};
+
+# pragma endregion
+
+# pragma region std_uniform_fixed_distribution
+
+// Distribution of `std_fixed' values uniform in the half-open range [a, b).
+template<class Fixed>
+class std_uniform_fixed_distribution
+{
+public:		/**** Member Types and Constants ****/
+	typedef Fixed result_type;
+
+public:		/**** Ctors ****/
+	explicit std_uniform_fixed_distribution(result_type a = result_type(), result_type b = result_type(1)) :
+		a_(a), b_(b), raw_(a.raw(), static_cast<typename Fixed::raw_type>(b.raw() - 1))
+	{
+
+	}
+
+public:		/**** Member Functions ****/
+	// Returns a value uniform in [a, b), in steps of the format's resolution.
+	template<class G>
+	result_type		operator()(G& g) { return result_type::from_raw(raw_(g)); }
+	void			reset() {}
+	result_type		a() const { return a_; }
+	result_type		b() const { return b_; }
+	result_type		min() const { return a_; }
+	result_type		max() const { return result_type::from_raw(b_.raw() - 1); }
+
+private:	/**** Member Objects ****/
+	result_type	a_;	// The lower bound.
+	result_type	b_;	// The upper bound, exclusive.
+	std_uniform_int_distribution<typename Fixed::raw_type> raw_;	// Distribution of the representations.
+};
+
+# pragma endregion
+
+# pragma region std_noise_seed
+
+// Accumulates noisy samples into a 64-bit seed.
+class std_noise_seeder
+{
+public:		/**** Member Types and Constants ****/
+	typedef uint64_t value_type;
+
+public:		/**** Ctors ****/
+	std_noise_seeder() : value_() {}
+
+public:		/**** Member Functions ****/
+	// Folds a sample into the seed.
+	void		update(uint32_t sample) { value_ = std_splitmix64_mix(value_ + std_splitmix64_gamma + sample); }
+	// Returns the seed of all samples folded in since construction or the last reset.
+	value_type	value() const { return value_; }
+	// Restarts the seed.
+	void		reset() { value_ = 0; }
+
+private:	/**** Member Objects ****/
+	value_type	value_;	// The current seed.
+};
+
+// Returns a seed gathered from `n' samples returned by the callable `source'.
+template<class Source>
+uint64_t std_noise_seed(Source source, size_t n = 64)
+{
+	// An ADC reading of a floating pin carries only a bit or two of noise in
+	// its low bits, so many samples are folded in. Mixing loses none of it.
+	std_noise_seeder seeder;
+
+	while (n--)
+		seeder.update(static_cast<uint32_t>(source()));
+
+	return seeder.value();
+}
+
+# pragma endregion
+
+#pragma region std_xorshift32_member_functions
+
+inline void std_xorshift32::seed(uint64_t value)
+{
+	state_ = static_cast<uint32_t>(std_splitmix64_mix(value + std_splitmix64_gamma) >> 32);
+	if (!state_)
+		state_ = 1;
+}
+
+inline std_xorshift32::result_type std_xorshift32::operator()()
+{
+	uint32_t x = state_;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	return state_ = x;
+}
+
+#pragma endregion
+
+#pragma region std_xoroshiro128pp_member_functions
+
+inline void std_xoroshiro128pp::seed(uint64_t value)
+{
+	std_splitmix64 seeder(value);
+
+	// SplitMix64 is a bijection of its state, so two consecutive results are never both zero.
+	state_[0] = seeder();
+	state_[1] = seeder();
+}
+
+inline std_xoroshiro128pp::result_type std_xoroshiro128pp::operator()()
+{
+	const uint64_t s0 = state_[0];
+	uint64_t s1 = state_[1];
+	const uint64_t result = std_rotl64(s0 + s1, 17) + s0;
+
+	s1 ^= s0;
+	state_[0] = std_rotl64(s0, 49) ^ s1 ^ (s1 << 21);
+	state_[1] = std_rotl64(s1, 28);
+
+	return result;
+}
+
+inline void std_xoroshiro128pp::jump()
+{
+	static const uint64_t Jump[] = { 0x2BD7A6A6E99C2DDCULL, 0x0992CCAF6A6F5AD1ULL };
+	uint64_t s0 = 0, s1 = 0;
+
+	for (unsigned i = 0; i < sizeof(Jump) / sizeof(Jump[0]); ++i)
+	{
+		for (unsigned b = 0; b < 64; ++b)
+		{
+			if (Jump[i] & (uint64_t(1) << b))
+			{
+				s0 ^= state_[0];
+				s1 ^= state_[1];
+			}
+			operator()();
+		}
+	}
+	state_[0] = s0;
+	state_[1] = s1;
+}
+
+#pragma endregion
+
+#pragma region std_pcg32_member_functions
+
+inline void std_pcg32::seed(uint64_t value, uint64_t stream)
+{
+	state_ = 0;
+	increment_ = (stream << 1) | 1;
+	operator()();
+	state_ += value;
+	operator()();
+}
+
+inline std_pcg32::result_type std_pcg32::operator()()
+{
+	const uint64_t s = state_;
+
+	state_ = s * Multiplier + increment_;
+
+	return std_rotr32(static_cast<uint32_t>(((s >> 18) ^ s) >> 27), static_cast<unsigned>(s >> 59));
+}
+
+inline void std_pcg32::discard(unsigned long long n)
+{
+	// Advance the LCG in O(log n) steps by composing its affine map with itself.
+	uint64_t mul = Multiplier, add = increment_, acc_mul = 1, acc_add = 0;
+
+	for (; n; n >>= 1)
+	{
+		if (n & 1)
+		{
+			acc_mul *= mul;
+			acc_add = acc_add * mul + add;
+		}
+		add = (mul + 1) * add;
+		mul *= mul;
+	}
+	state_ = acc_mul * state_ + acc_add;
+}
+
+#pragma endregion
+
+#pragma region std_uniform_int_distribution_member_functions
+
+template<class IntType>
+template<class G>
+typename std_uniform_int_distribution<IntType>::result_type std_uniform_int_distribution<IntType>::operator()(G& g)
+{
+	const int Bits = CHAR_BIT * sizeof(range_type);
+	range_type x = std_random_bits<range_type>(g);
+
+	if (range_ == static_cast<range_type>(-1))
+		return static_cast<result_type>(static_cast<range_type>(a_) + x);
+
+	// Lemire's method: the high half of `x * s' is uniform in [0, s) unless the low half
+	// falls below `2^Bits mod s', which is rare, and only then is a division needed.
+	const range_type s = range_ + 1;
+	wide_type m = static_cast<wide_type>(x) * s;
+	range_type l = static_cast<range_type>(m);
+
+	if (l < s)
+	{
+		const range_type t = static_cast<range_type>(-s) % s;
+
+		while (l < t)
+		{
+			x = std_random_bits<range_type>(g);
+			m = static_cast<wide_type>(x) * s;
+			l = static_cast<range_type>(m);
+		}
+	}
+
+	return static_cast<result_type>(static_cast<range_type>(a_) + static_cast<range_type>(m >> Bits));
+}
+
+#pragma endregion
+
+#pragma region std_bernoulli_distribution_ctors
+
+inline std_bernoulli_distribution::std_bernoulli_distribution(double p) :
+	threshold_(p <= 0.0 || p >= 1.0 ? 0 : static_cast<uint32_t>(p * 4294967296.0)), certain_(p >= 1.0)
+{
+	assert(p >= 0.0 && p <= 1.0);
+}
+
+inline std_bernoulli_distribution::std_bernoulli_distribution(uint32_t numerator, uint32_t denominator) :
+	threshold_(numerator >= denominator ? 0 : static_cast<uint32_t>((static_cast<uint64_t>(numerator) << 32) / denominator)),
+	certain_(numerator >= denominator)
+{
+	assert(denominator && numerator <= denominator);
+}
+
+#pragma endregion
+
+#endif // !defined RANDOM_H__
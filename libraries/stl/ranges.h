@@ -0,0 +1,578 @@
+/*
+ *	This file defines several C++ Standard Template Library (STL) lazy range
+ *	views and adaptors.
+ *
+ *	***************************************************************************
+ *
+ *	File: ranges.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines some of the views and range adaptors of the C++20
+ *		<ranges> header of a C++ Standard Template Library (STL)
+ *		implementation, plus `stride' and `enumerate' from C++23. A view is a
+ *		lightweight range that refers to the elements of another range and
+ *		traverses them lazily, filtered, transformed or otherwise adapted,
+ *		without copying them into temporaries:
+ *
+ *			std_views_filter(range, pred)		elements for which `pred' is true,
+ *			std_views_transform(range, f)		`f' applied to each element,
+ *			std_views_take(range, n)			the first `n' elements,
+ *			std_views_drop(range, n)			all but the first `n' elements,
+ *			std_views_stride(range, n)			every `n'th element,
+ *			std_views_enumerate(range)			(index, element) pairs.
+ *
+ *		Each adaptor called without the range returns a closure that applies
+ *		it with the `|' operator, so views compose from left to right:
+ *
+ *			for (auto e : events | std_views_drop(1) | std_views_stride(2) | std_views_enumerate())
+ *				print(e.first, e.second->name_);
+ *
+ *		Views hold the views they adapt by value and refer to other ranges,
+ *		such as containers and C-style arrays, through an `std_subrange' of
+ *		their iterators. A composed view is therefore a single object on the
+ *		stack, built without allocation, and since every iterator operation
+ *		is inline, a loop over it compiles to a plain loop with no calls,
+ *		much like the hand-written one. Ranges that aren't views must outlive
+ *		the views that refer to them.
+ *
+ *		All view iterators are forward iterators. Filter predicates and
+ *		transform functions are called through a const reference, so
+ *		lambdas must not be `mutable'.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_' and `std::views::' by `std_views_'.
+ *
+ *	**************************************************************************/
+
+#if !defined RANGES_H__
+# define RANGES_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stddef.h>			// `size_t', `ptrdiff_t'.
+# include "type_traits.h"		// `std_declval()', `std_decay', `std_is_convertible'.
+# include "utility.h"			// `std_pair', `std_forward()'.
+# include "iterator.h"			// `std_begin()', `std_end()', `std_forward_iterator_tag'.
+# include "span.h"				// `std_span'.
+
+// Base class of all views.
+struct std_view_base {};
+
+// Checks whether `T' is a view, a range that refers to elements it doesn't own.
+template<class T>
+struct std_enable_view : std_integral_constant<bool, std_is_convertible<T*, const std_view_base*>::value> {};
+
+template<class T, size_t Extent>
+struct std_enable_view<std_span<T, Extent>> : std_true_type {};
+
+// Nested types common to all view iterators, which yield `Reference'.
+template<class Reference>
+struct std_view_iterator
+{
+	typedef std_forward_iterator_tag iterator_category;
+	typedef typename std_decay<Reference>::type value_type;
+	typedef ptrdiff_t difference_type;
+	typedef typename std_remove_reference<Reference>::type* pointer;
+	typedef Reference reference;
+};
+
+# pragma region std_subrange
+
+// View of the elements in the range [first, last).
+template<class It>
+class std_subrange : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef It iterator;
+	typedef It const_iterator;
+
+public:		/**** Ctors ****/
+	std_subrange(It first, It last) : first_(first), last_(last) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return first_; }
+	iterator	end() const { return last_; }
+	bool		empty() const { return first_ == last_; }
+
+private:	/**** Member Objects ****/
+	It	first_;	// The first element.
+	It	last_;	// One past the last element.
+};
+
+# pragma endregion
+
+# pragma region std_views_all
+
+// Type and conversion of a range `R' to a view: views convert to themselves.
+template<class R, class U = typename std_remove_cv<typename std_remove_reference<R>::type>::type,
+	bool = std_enable_view<U>::value>
+struct std_views_all
+{
+	typedef U type;
+
+	static const U& get(const U& r) { return r; }
+};
+
+// Other ranges convert to an `std_subrange' of their iterators.
+template<class R, class U>
+struct std_views_all<R, U, false>
+{
+	typedef typename std_remove_reference<R>::type range_type;
+	typedef std_subrange<decltype(std_begin(std_declval<range_type&>()))> type;
+
+	static type get(range_type& r) { return type(std_begin(r), std_end(r)); }
+};
+
+# pragma endregion
+
+# pragma region std_filter_view
+
+// View of the elements of `V' that satisfy the predicate `Pred'.
+template<class V, class Pred>
+class std_filter_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) base_iterator;
+	typedef decltype(*std_declval<base_iterator&>()) base_reference;
+
+	class iterator : public std_view_iterator<base_reference>
+	{
+	public:
+		iterator() : view_(), it_() {}
+		iterator(const std_filter_view* view, base_iterator it) : view_(view), it_(it) { satisfy(); }
+
+	public:
+		base_reference	operator*() const { return *it_; }
+		iterator&		operator++() { ++it_; satisfy(); return *this; }
+		iterator		operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+		bool			operator==(const iterator& other) const { return it_ == other.it_; }
+		bool			operator!=(const iterator& other) const { return !(*this == other); }
+		base_iterator	base() const { return it_; }
+
+	private:
+		// Skips elements that don't satisfy the predicate.
+		void satisfy()
+		{
+			const base_iterator last = view_->base_.end();
+
+			while (it_ != last && !view_->pred_(*it_))
+				++it_;
+		}
+
+	private:
+		const std_filter_view*	view_;
+		base_iterator			it_;
+	};
+
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	std_filter_view(const V& base, const Pred& pred) : base_(base), pred_(pred) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return iterator(this, base_.begin()); }
+	iterator	end() const { return iterator(this, base_.end()); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V		base_;	// The adapted view.
+	Pred	pred_;	// The predicate elements must satisfy.
+};
+
+template<class Pred>
+struct std_filter_closure
+{
+	Pred	pred;
+};
+
+// Returns a view of the elements of `r' that satisfy `pred'.
+template<class R, class Pred>
+std_filter_view<typename std_views_all<R>::type, Pred> std_views_filter(R&& r, Pred pred)
+{
+	return std_filter_view<typename std_views_all<R>::type, Pred>(std_views_all<R>::get(r), pred);
+}
+
+// Returns a closure that filters a range piped into it with `pred'.
+template<class Pred>
+std_filter_closure<Pred> std_views_filter(Pred pred)
+{
+	return std_filter_closure<Pred>{ pred };
+}
+
+template<class R, class Pred>
+std_filter_view<typename std_views_all<R>::type, Pred> operator|(R&& r, const std_filter_closure<Pred>& c)
+{
+	return std_views_filter(std_forward<R>(r), c.pred);
+}
+
+# pragma endregion
+
+# pragma region std_transform_view
+
+// View of the results of applying `F' to the elements of `V'.
+template<class V, class F>
+class std_transform_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) base_iterator;
+	typedef decltype(std_declval<const F&>()(*std_declval<base_iterator&>())) reference;
+
+	class iterator : public std_view_iterator<reference>
+	{
+	public:
+		iterator() : view_(), it_() {}
+		iterator(const std_transform_view* view, base_iterator it) : view_(view), it_(it) {}
+
+	public:
+		reference		operator*() const { return view_->f_(*it_); }
+		iterator&		operator++() { ++it_; return *this; }
+		iterator		operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+		bool			operator==(const iterator& other) const { return it_ == other.it_; }
+		bool			operator!=(const iterator& other) const { return !(*this == other); }
+		base_iterator	base() const { return it_; }
+
+	private:
+		const std_transform_view*	view_;
+		base_iterator				it_;
+	};
+
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	std_transform_view(const V& base, const F& f) : base_(base), f_(f) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return iterator(this, base_.begin()); }
+	iterator	end() const { return iterator(this, base_.end()); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V	base_;	// The adapted view.
+	F	f_;		// The function applied to each element.
+};
+
+template<class F>
+struct std_transform_closure
+{
+	F	f;
+};
+
+// Returns a view of the results of applying `f' to the elements of `r'.
+template<class R, class F>
+std_transform_view<typename std_views_all<R>::type, F> std_views_transform(R&& r, F f)
+{
+	return std_transform_view<typename std_views_all<R>::type, F>(std_views_all<R>::get(r), f);
+}
+
+// Returns a closure that applies `f' to the elements of a range piped into it.
+template<class F>
+std_transform_closure<F> std_views_transform(F f)
+{
+	return std_transform_closure<F>{ f };
+}
+
+template<class R, class F>
+std_transform_view<typename std_views_all<R>::type, F> operator|(R&& r, const std_transform_closure<F>& c)
+{
+	return std_views_transform(std_forward<R>(r), c.f);
+}
+
+# pragma endregion
+
+# pragma region std_take_view
+
+// View of the first `n' elements of `V', or all of them if there are fewer.
+template<class V>
+class std_take_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) base_iterator;
+	typedef decltype(*std_declval<base_iterator&>()) base_reference;
+
+	class iterator : public std_view_iterator<base_reference>
+	{
+	public:
+		iterator() : it_(), n_() {}
+		iterator(base_iterator it, size_t n) : it_(it), n_(n) {}
+
+	public:
+		base_reference	operator*() const { return *it_; }
+		iterator&		operator++() { ++it_; --n_; return *this; }
+		iterator		operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+		// The end is reached at the end of `V' or after `n' elements, whichever is first.
+		bool			operator==(const iterator& other) const { return it_ == other.it_ || (n_ == 0 && other.n_ == 0); }
+		bool			operator!=(const iterator& other) const { return !(*this == other); }
+		base_iterator	base() const { return it_; }
+
+	private:
+		base_iterator	it_;
+		size_t			n_;	// Number of elements left to take.
+	};
+
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	std_take_view(const V& base, size_t n) : base_(base), n_(n) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return iterator(base_.begin(), n_); }
+	iterator	end() const { return iterator(base_.end(), 0); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V		base_;	// The adapted view.
+	size_t	n_;		// Number of elements to take.
+};
+
+struct std_take_closure
+{
+	size_t	n;
+};
+
+// Returns a view of the first `n' elements of `r'.
+template<class R>
+std_take_view<typename std_views_all<R>::type> std_views_take(R&& r, size_t n)
+{
+	return std_take_view<typename std_views_all<R>::type>(std_views_all<R>::get(r), n);
+}
+
+// Returns a closure that takes the first `n' elements of a range piped into it.
+inline std_take_closure std_views_take(size_t n)
+{
+	return std_take_closure{ n };
+}
+
+template<class R>
+std_take_view<typename std_views_all<R>::type> operator|(R&& r, const std_take_closure& c)
+{
+	return std_views_take(std_forward<R>(r), c.n);
+}
+
+# pragma endregion
+
+# pragma region std_drop_view
+
+// View of all but the first `n' elements of `V'.
+template<class V>
+class std_drop_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) iterator;
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	std_drop_view(const V& base, size_t n) : base_(base), n_(n) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const;
+	iterator	end() const { return base_.end(); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V		base_;	// The adapted view.
+	size_t	n_;		// Number of elements to drop.
+};
+
+template<class V>
+typename std_drop_view<V>::iterator std_drop_view<V>::begin() const
+{
+	const iterator last = base_.end();
+	iterator it = base_.begin();
+
+	for (size_t i = 0; i < n_ && it != last; ++i)
+		++it;
+
+	return it;
+}
+
+struct std_drop_closure
+{
+	size_t	n;
+};
+
+// Returns a view of all but the first `n' elements of `r'.
+template<class R>
+std_drop_view<typename std_views_all<R>::type> std_views_drop(R&& r, size_t n)
+{
+	return std_drop_view<typename std_views_all<R>::type>(std_views_all<R>::get(r), n);
+}
+
+// Returns a closure that drops the first `n' elements of a range piped into it.
+inline std_drop_closure std_views_drop(size_t n)
+{
+	return std_drop_closure{ n };
+}
+
+template<class R>
+std_drop_view<typename std_views_all<R>::type> operator|(R&& r, const std_drop_closure& c)
+{
+	return std_views_drop(std_forward<R>(r), c.n);
+}
+
+# pragma endregion
+
+# pragma region std_stride_view
+
+// View of every `n'th element of `V', starting with the first.
+template<class V>
+class std_stride_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) base_iterator;
+	typedef decltype(*std_declval<base_iterator&>()) base_reference;
+
+	class iterator : public std_view_iterator<base_reference>
+	{
+	public:
+		iterator() : it_(), last_(), n_() {}
+		iterator(base_iterator it, base_iterator last, size_t n) : it_(it), last_(last), n_(n) {}
+
+	public:
+		base_reference	operator*() const { return *it_; }
+		iterator&		operator++() { for (size_t i = n_; i != 0 && it_ != last_; --i) ++it_; return *this; }
+		iterator		operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+		bool			operator==(const iterator& other) const { return it_ == other.it_; }
+		bool			operator!=(const iterator& other) const { return !(*this == other); }
+		base_iterator	base() const { return it_; }
+
+	private:
+		base_iterator	it_;
+		base_iterator	last_;	// The end of `V', which strides stop at.
+		size_t			n_;		// The stride.
+	};
+
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	std_stride_view(const V& base, size_t n) : base_(base), n_(n) { assert(n != 0); }
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return iterator(base_.begin(), base_.end(), n_); }
+	iterator	end() const { return iterator(base_.end(), base_.end(), n_); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V		base_;	// The adapted view.
+	size_t	n_;		// The stride.
+};
+
+struct std_stride_closure
+{
+	size_t	n;
+};
+
+// Returns a view of every `n'th element of `r'.
+template<class R>
+std_stride_view<typename std_views_all<R>::type> std_views_stride(R&& r, size_t n)
+{
+	return std_stride_view<typename std_views_all<R>::type>(std_views_all<R>::get(r), n);
+}
+
+// Returns a closure that takes every `n'th element of a range piped into it.
+inline std_stride_closure std_views_stride(size_t n)
+{
+	return std_stride_closure{ n };
+}
+
+template<class R>
+std_stride_view<typename std_views_all<R>::type> operator|(R&& r, const std_stride_closure& c)
+{
+	return std_views_stride(std_forward<R>(r), c.n);
+}
+
+# pragma endregion
+
+# pragma region std_enumerate_view
+
+// View of (index, element) pairs of the elements of `V'.
+template<class V>
+class std_enumerate_view : public std_view_base
+{
+public:		/**** Member Types and Constants ****/
+	typedef decltype(std_declval<const V&>().begin()) base_iterator;
+	typedef decltype(*std_declval<base_iterator&>()) base_reference;
+	typedef std_pair<size_t, base_reference> reference;
+
+	class iterator : public std_view_iterator<reference>
+	{
+	public:
+		iterator() : it_(), index_() {}
+		iterator(base_iterator it, size_t index) : it_(it), index_(index) {}
+
+	public:
+		reference		operator*() const { return reference(index_, *it_); }
+		iterator&		operator++() { ++it_; ++index_; return *this; }
+		iterator		operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+		bool			operator==(const iterator& other) const { return it_ == other.it_; }
+		bool			operator!=(const iterator& other) const { return !(*this == other); }
+		base_iterator	base() const { return it_; }
+		size_t			index() const { return index_; }
+
+	private:
+		base_iterator	it_;
+		size_t			index_;	// Index of the current element.
+	};
+
+	typedef iterator const_iterator;
+
+public:		/**** Ctors ****/
+	explicit std_enumerate_view(const V& base) : base_(base) {}
+
+public:		/**** Member Functions ****/
+	iterator	begin() const { return iterator(base_.begin(), 0); }
+	iterator	end() const { return iterator(base_.end(), 0); }
+	const V&	base() const { return base_; }
+
+private:	/**** Member Objects ****/
+	V	base_;	// The adapted view.
+};
+
+struct std_enumerate_closure {};
+
+// Returns a view of (index, element) pairs of the elements of `r'.
+template<class R>
+std_enumerate_view<typename std_views_all<R>::type> std_views_enumerate(R&& r)
+{
+	return std_enumerate_view<typename std_views_all<R>::type>(std_views_all<R>::get(r));
+}
+
+// Returns a closure that enumerates the elements of a range piped into it.
+inline std_enumerate_closure std_views_enumerate()
+{
+	return std_enumerate_closure();
+}
+
+template<class R>
+std_enumerate_view<typename std_views_all<R>::type> operator|(R&& r, std_enumerate_closure)
+{
+	return std_views_enumerate(std_forward<R>(r));
+}
+
+# pragma endregion
+
+#endif // !defined RANGES_H__
@@ -0,0 +1,500 @@
+/*
+ *	This file defines two fixed-capacity circular buffer (FIFO) types.
+ *
+ *  ***************************************************************************
+ *
+ *	File: ring_buffer.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	**************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines two circular buffer types with a compile-time
+ *		capacity `N', which must be a power of two. Elements are stored in an
+ *		inline array and the read and write positions are free-running
+ *		counters that are reduced modulo `N' with a bit mask, so no division
+ *		or branching is needed to wrap around.
+ *
+ *		`std_ring_buffer' is a double-ended queue that can be pushed and
+ *		popped at either end and indexed from the front. It is not safe for
+ *		concurrent use.
+ *
+ *		`std_spsc_ring_buffer' is a single-producer, single-consumer FIFO
+ *		that is safe to share between one interrupt service routine and the
+ *		main loop, with either one as the producer. The producer only writes
+ *		the write position and the consumer only writes the read position,
+ *		and each position is published with release semantics after the
+ *		element data is written, so no critical section is needed around
+ *		the data. On AVR targets the positions are single bytes whenever
+ *		N <= 128, so they are read and written atomically; larger positions
+ *		are read with interrupts disabled.
+ *
+ *		Both types support bulk transfers. `push(const T*, n)' and
+ *		`pop(T*, n)' copy up to `n' elements in at most two contiguous
+ *		blocks. For zero-copy use, `write_span()' and `read_span()' return
+ *		the largest contiguous free or used region as a pointer and length,
+ *		which clients can fill or drain directly (e.g. with `memcpy()' or
+ *		`Serial.readBytes()') and then release with `commit()' or `consume()':
+ *
+ *			std_spsc_ring_buffer<char, 64> rx;
+ *			...
+ *			std_pair<char*, size_t> span = rx.write_span();
+ *			rx.commit(Serial.readBytes(span.first, span.second));
+ *
+ *	**************************************************************************/
+
+#if !defined RING_BUFFER_H__
+# define RING_BUFFER_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stdint.h>			// Fixed-width integral types.
+# if defined __AVR__
+#  include <util/atomic.h>		// `ATOMIC_BLOCK' macro.
+# endif
+# include "type_traits.h"		// `std_conditional'.
+# include "utility.h"			// `std_pair', `std_move()'.
+
+namespace
+{
+	// Selects the smallest unsigned type that can hold the free-running
+	// positions of a buffer of capacity `N', which must be able to count
+	// to at least 2N so that a full buffer is distinguishable from an empty
+	// one.
+	template<size_t N>
+	struct std_ring_index
+	{
+		typedef typename std_conditional<(N <= 128U), uint8_t,
+			typename std_conditional<(N <= 32768U), uint16_t, size_t>::type>::type type;
+	};
+
+	// Copies the contiguous range [first, last) to `dest'. `std_copy()' isn't
+	// used because its pointer overload dereferences pointer-to-pointer ranges.
+	template<class T>
+	inline T* std_ring_copy(const T* first, const T* last, T* dest)
+	{
+		while (first != last)
+			*dest++ = *first++;
+		return dest;
+	}
+
+	// Reads a position published by the other side of an SPSC buffer.
+	template<class T>
+	inline T std_ring_load_acquire(const volatile T& pos)
+	{
+# if defined __AVR__
+		T value;
+		if (sizeof(T) == 1)
+			value = pos;
+		else
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { value = pos; }
+		__asm__ __volatile__("" ::: "memory");	// Don't hoist data reads above.
+		return value;
+# else
+		return __atomic_load_n(&pos, __ATOMIC_ACQUIRE);
+# endif
+	}
+
+	// Publishes a position to the other side of an SPSC buffer.
+	template<class T>
+	inline void std_ring_store_release(volatile T& pos, T value)
+	{
+# if defined __AVR__
+		__asm__ __volatile__("" ::: "memory");	// Don't sink data writes below.
+		if (sizeof(T) == 1)
+			pos = value;
+		else
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { pos = value; }
+# else
+		__atomic_store_n(&pos, value, __ATOMIC_RELEASE);
+# endif
+	}
+} // namespace
+
+# pragma region std_ring_buffer
+
+// Fixed-capacity circular double-ended queue.
+template<class T, size_t N>
+class std_ring_buffer
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "std_ring_buffer capacity must be a power of two.");
+
+public:		/**** Member Types and Constants ****/
+	typedef std_ring_buffer<T, N> self_type;
+	typedef T value_type;
+	typedef size_t size_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef typename std_ring_index<N>::type index_type;
+	typedef std_pair<pointer, size_type> span_type;
+	typedef std_pair<const_pointer, size_type> const_span_type;
+
+public:		/**** Ctors ****/
+	std_ring_buffer() : data_(), head_(), tail_() {}
+
+public:		/**** Member Functions ****/
+	// Returns a mutable reference to the n-th element from the front.
+	reference		operator[](size_type n) { return data_[(tail_ + n) & Mask]; }
+	// Returns an immutable reference to the n-th element from the front.
+	const_reference operator[](size_type n) const { return data_[(tail_ + n) & Mask]; }
+	// Returns a mutable reference to the first element.
+	reference		front() { return data_[tail_ & Mask]; }
+	// Returns an immutable reference to the first element.
+	const_reference front() const { return data_[tail_ & Mask]; }
+	// Returns a mutable reference to the last element.
+	reference		back() { return data_[(head_ - 1U) & Mask]; }
+	// Returns an immutable reference to the last element.
+	const_reference back() const { return data_[(head_ - 1U) & Mask]; }
+	// Returns the number of elements in the buffer.
+	size_type		size() const { return static_cast<index_type>(head_ - tail_); }
+	// Returns the maximum number of elements the buffer can hold.
+	static constexpr size_type capacity() { return N; }
+	// Returns `true' if the buffer is empty, else returns `false'.
+	bool			empty() const { return head_ == tail_; }
+	// Returns `true' if the buffer is full, else returns `false'.
+	bool			full() const { return size() == N; }
+	// Removes all elements from the buffer.
+	void			clear() { head_ = tail_ = 0; }
+	// Appends an element, returns `false' if the buffer is full.
+	bool			push_back(const_reference);
+	// Appends an element, returns `false' if the buffer is full.
+	bool			push_back(value_type&&);
+	// Prepends an element, returns `false' if the buffer is full.
+	bool			push_front(const_reference);
+	// Removes the first element.
+	void			pop_front();
+	// Removes the last element.
+	void			pop_back();
+	// Appends up to `n' elements, returns the number appended.
+	size_type		push(const_pointer, size_type);
+	// Removes up to `n' elements from the front, returns the number removed.
+	size_type		pop(pointer, size_type);
+	// Returns the largest contiguous free region after the last element.
+	span_type		write_span();
+	// Appends `n' elements previously written to `write_span()'.
+	void			commit(size_type);
+	// Returns the largest contiguous region of elements from the front.
+	const_span_type	read_span() const;
+	// Removes `n' elements from the front.
+	void			consume(size_type);
+
+private:	/**** Member Objects ****/
+	static const index_type Mask = static_cast<index_type>(N - 1U);
+
+	T			data_[N];	// Element storage.
+	index_type	head_;		// Write position (one past the last element).
+	index_type	tail_;		// Read position (the first element).
+};
+
+# pragma endregion
+
+# pragma region std_spsc_ring_buffer
+
+// Single-producer, single-consumer lock-free FIFO.
+template<class T, size_t N>
+class std_spsc_ring_buffer
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "std_spsc_ring_buffer capacity must be a power of two.");
+
+public:		/**** Member Types and Constants ****/
+	typedef std_spsc_ring_buffer<T, N> self_type;
+	typedef T value_type;
+	typedef size_t size_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef typename std_ring_index<N>::type index_type;
+	typedef std_pair<pointer, size_type> span_type;
+	typedef std_pair<const_pointer, size_type> const_span_type;
+
+public:		/**** Ctors ****/
+	std_spsc_ring_buffer() : data_(), head_(), tail_() {}
+	std_spsc_ring_buffer(const self_type&) = delete;
+	self_type& operator=(const self_type&) = delete;
+
+public:		/**** Producer Functions ****/
+	// Appends an element, returns `false' if the buffer is full.
+	bool			push(const_reference);
+	// Appends up to `n' elements, returns the number appended.
+	size_type		push(const_pointer, size_type);
+	// Returns the largest contiguous free region.
+	span_type		write_span();
+	// Publishes `n' elements previously written to `write_span()'.
+	void			commit(size_type);
+
+public:		/**** Consumer Functions ****/
+	// Removes the first element into `value', returns `false' if the buffer is empty.
+	bool			pop(reference);
+	// Removes up to `n' elements, returns the number removed.
+	size_type		pop(pointer, size_type);
+	// Returns the largest contiguous region of published elements.
+	const_span_type	read_span() const;
+	// Releases `n' elements previously read from `read_span()'.
+	void			consume(size_type);
+
+public:		/**** Observers ****/
+	// Returns the number of elements in the buffer, which may be stale.
+	size_type		size() const;
+	// Returns the maximum number of elements the buffer can hold.
+	static constexpr size_type capacity() { return N; }
+	// Returns `true' if the buffer is empty, else returns `false'.
+	bool			empty() const { return size() == 0; }
+	// Returns `true' if the buffer is full, else returns `false'.
+	bool			full() const { return size() == N; }
+
+private:	/**** Member Objects ****/
+	static const index_type Mask = static_cast<index_type>(N - 1U);
+
+	T						data_[N];	// Element storage.
+	volatile index_type		head_;		// Write position, written only by the producer.
+	volatile index_type		tail_;		// Read position, written only by the consumer.
+};
+
+# pragma endregion
+
+#pragma region std_ring_buffer_member_functions
+
+template<class T, size_t N>
+bool std_ring_buffer<T, N>::push_back(const_reference value)
+{
+	if (full())
+		return false;
+	data_[head_++ & Mask] = value;
+	return true;
+}
+
+template<class T, size_t N>
+bool std_ring_buffer<T, N>::push_back(value_type&& value)
+{
+	if (full())
+		return false;
+	data_[head_++ & Mask] = std_move(value);
+	return true;
+}
+
+template<class T, size_t N>
+bool std_ring_buffer<T, N>::push_front(const_reference value)
+{
+	if (full())
+		return false;
+	data_[--tail_ & Mask] = value;
+	return true;
+}
+
+template<class T, size_t N>
+void std_ring_buffer<T, N>::pop_front()
+{
+	assert(!empty());
+	++tail_;
+}
+
+template<class T, size_t N>
+void std_ring_buffer<T, N>::pop_back()
+{
+	assert(!empty());
+	--head_;
+}
+
+template<class T, size_t N>
+	typename std_ring_buffer<T, N>::size_type
+		std_ring_buffer<T, N>::push(const_pointer src, size_type n)
+{
+	size_type count = 0;
+
+	// At most two passes: up to the end of storage, then from the start.
+	while (count < n && !full())
+	{
+		span_type span = write_span();
+		size_type len = n - count < span.second ? n - count : span.second;
+
+		std_ring_copy(src + count, src + count + len, span.first);
+		commit(len);
+		count += len;
+	}
+	return count;
+}
+
+template<class T, size_t N>
+	typename std_ring_buffer<T, N>::size_type
+		std_ring_buffer<T, N>::pop(pointer dest, size_type n)
+{
+	size_type count = 0;
+
+	while (count < n && !empty())
+	{
+		const_span_type span = read_span();
+		size_type len = n - count < span.second ? n - count : span.second;
+
+		std_ring_copy(span.first, span.first + len, dest + count);
+		consume(len);
+		count += len;
+	}
+	return count;
+}
+
+template<class T, size_t N>
+	typename std_ring_buffer<T, N>::span_type
+		std_ring_buffer<T, N>::write_span()
+{
+	size_type pos = head_ & Mask, free = N - size(), contiguous = N - pos;
+
+	return span_type(data_ + pos, free < contiguous ? free : contiguous);
+}
+
+template<class T, size_t N>
+void std_ring_buffer<T, N>::commit(size_type n)
+{
+	assert(n <= N - size());
+	head_ += static_cast<index_type>(n);
+}
+
+template<class T, size_t N>
+	typename std_ring_buffer<T, N>::const_span_type
+		std_ring_buffer<T, N>::read_span() const
+{
+	size_type pos = tail_ & Mask, used = size(), contiguous = N - pos;
+
+	return const_span_type(data_ + pos, used < contiguous ? used : contiguous);
+}
+
+template<class T, size_t N>
+void std_ring_buffer<T, N>::consume(size_type n)
+{
+	assert(n <= size());
+	tail_ += static_cast<index_type>(n);
+}
+
+#pragma endregion
+
+#pragma region std_spsc_ring_buffer_member_functions
+
+template<class T, size_t N>
+bool std_spsc_ring_buffer<T, N>::push(const_reference value)
+{
+	const index_type head = head_;	// Only the producer writes `head_'.
+
+	if (static_cast<index_type>(head - std_ring_load_acquire(tail_)) == N)
+		return false;
+	data_[head & Mask] = value;
+	std_ring_store_release(head_, static_cast<index_type>(head + 1U));
+	return true;
+}
+
+template<class T, size_t N>
+	typename std_spsc_ring_buffer<T, N>::size_type
+		std_spsc_ring_buffer<T, N>::push(const_pointer src, size_type n)
+{
+	size_type count = 0;
+
+	while (count < n)
+	{
+		span_type span = write_span();
+		size_type len = n - count < span.second ? n - count : span.second;
+
+		if (len == 0)
+			break;
+		std_ring_copy(src + count, src + count + len, span.first);
+		commit(len);
+		count += len;
+	}
+	return count;
+}
+
+template<class T, size_t N>
+	typename std_spsc_ring_buffer<T, N>::span_type
+		std_spsc_ring_buffer<T, N>::write_span()
+{
+	const index_type head = head_;
+	size_type pos = head & Mask, contiguous = N - pos,
+		free = N - static_cast<index_type>(head - std_ring_load_acquire(tail_));
+
+	return span_type(data_ + pos, free < contiguous ? free : contiguous);
+}
+
+template<class T, size_t N>
+void std_spsc_ring_buffer<T, N>::commit(size_type n)
+{
+	std_ring_store_release(head_, static_cast<index_type>(head_ + n));
+}
+
+template<class T, size_t N>
+bool std_spsc_ring_buffer<T, N>::pop(reference value)
+{
+	const index_type tail = tail_;	// Only the consumer writes `tail_'.
+
+	if (std_ring_load_acquire(head_) == tail)
+		return false;
+	value = std_move(data_[tail & Mask]);
+	std_ring_store_release(tail_, static_cast<index_type>(tail + 1U));
+	return true;
+}
+
+template<class T, size_t N>
+	typename std_spsc_ring_buffer<T, N>::size_type
+		std_spsc_ring_buffer<T, N>::pop(pointer dest, size_type n)
+{
+	size_type count = 0;
+
+	while (count < n)
+	{
+		const_span_type span = read_span();
+		size_type len = n - count < span.second ? n - count : span.second;
+
+		if (len == 0)
+			break;
+		std_ring_copy(span.first, span.first + len, dest + count);
+		consume(len);
+		count += len;
+	}
+	return count;
+}
+
+template<class T, size_t N>
+	typename std_spsc_ring_buffer<T, N>::const_span_type
+		std_spsc_ring_buffer<T, N>::read_span() const
+{
+	const index_type tail = tail_;
+	size_type pos = tail & Mask, contiguous = N - pos,
+		used = static_cast<index_type>(std_ring_load_acquire(head_) - tail);
+
+	return const_span_type(data_ + pos, used < contiguous ? used : contiguous);
+}
+
+template<class T, size_t N>
+void std_spsc_ring_buffer<T, N>::consume(size_type n)
+{
+	std_ring_store_release(tail_, static_cast<index_type>(tail_ + n));
+}
+
+template<class T, size_t N>
+	typename std_spsc_ring_buffer<T, N>::size_type
+		std_spsc_ring_buffer<T, N>::size() const
+{
+	return static_cast<index_type>(std_ring_load_acquire(head_) - std_ring_load_acquire(tail_));
+}
+
+#pragma endregion
+
+#endif // !defined RING_BUFFER_H__
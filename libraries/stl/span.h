@@ -0,0 +1,190 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) non-owning view
+ *	over a contiguous sequence of objects.
+ *
+ *	***************************************************************************
+ *
+ *	File: span.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_span' type from the C++20 <span> header of
+ *		a C++ Standard Template Library (STL) implementation. A span refers
+ *		to a contiguous sequence of objects it doesn't own, such as a C-style
+ *		array, an `std_array' or an `ArrayWrapper', and is cheap to copy and
+ *		to slice: `first()', `last()' and `subspan()' return narrower spans
+ *		over the same objects, without constructor calls or index arithmetic
+ *		at the call site:
+ *
+ *			std_span<event_type*> pool(events);
+ *			...
+ *			std_span<event_type*> sequence = pool.subspan(i, n);
+ *
+ *		A span whose `Extent' is known at compile time stores only a pointer,
+ *		its size being a constant. Otherwise `Extent' is `std_dynamic_extent'
+ *		and the span stores a pointer and a size, like `ArrayWrapper'.
+ *
+ *		Since C++11 has no class template argument deduction, the element
+ *		type must be given explicitly. Spans have no `at()' member or
+ *		`std_as_bytes()' functions, and out-of-range accesses are caught by
+ *		`assert()'.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined SPAN_H__
+# define SPAN_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stddef.h>			// `size_t', `ptrdiff_t'.
+# include "type_traits.h"		// `std_enable_if', `std_is_convertible', `std_declval()'.
+
+// Extent of a span whose size is only known at run time.
+const size_t std_dynamic_extent = static_cast<size_t>(-1);
+
+// Storage of a span with static extent `Extent', only a pointer.
+template<class T, size_t Extent>
+struct std_span_storage
+{
+	// Every constructor with a run-time size passes it here to be checked against the extent.
+	constexpr std_span_storage(T* p, size_t n) : data_((assert(n == Extent), p)) {}
+	constexpr size_t size() const { return Extent; }
+
+	T*	data_;
+};
+
+// Storage of a span with dynamic extent, a pointer and a size.
+template<class T>
+struct std_span_storage<T, std_dynamic_extent>
+{
+	constexpr std_span_storage(T* p, size_t n) : data_(p), size_(n) {}
+	constexpr size_t size() const { return size_; }
+
+	T*		data_;
+	size_t	size_;
+};
+
+# pragma region std_span
+
+// Non-owning view over a contiguous sequence of `Extent' objects of type `T'.
+template<class T, size_t Extent = std_dynamic_extent>
+class std_span
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_span<T, Extent> self_type;
+	typedef T element_type;
+	typedef typename std_remove_cv<T>::type value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef pointer iterator;
+	typedef pointer const_iterator;
+
+	static const size_type extent = Extent;
+
+private:
+	// Extent of `subspan<Offset, Count>()'.
+	template<size_type Offset, size_type Count>
+	struct subspan_extent : std_integral_constant<size_type, Count != std_dynamic_extent ? Count :
+		Extent != std_dynamic_extent ? Extent - Offset : std_dynamic_extent> {};
+
+public:		/**** Ctors ****/
+	template<size_type E = Extent, class = typename std_enable_if<E == 0 || E == std_dynamic_extent>::type>
+	constexpr std_span() : storage_(nullptr, 0) {}
+	constexpr std_span(pointer p, size_type n) : storage_(p, n) {}
+	constexpr std_span(pointer first, pointer last) : storage_(first, last - first) {}
+	template<size_t N, class = typename std_enable_if<Extent == std_dynamic_extent || N == Extent>::type>
+	constexpr std_span(element_type (&arr)[N]) : storage_(arr, N) {}
+	// Constructs a span over any container with `data()' and `size()' members.
+	template<class C, class = typename std_enable_if<
+		std_is_convertible<decltype(std_declval<C&>().data()), pointer>::value>::type>
+	constexpr std_span(C& c) : storage_(c.data(), c.size()) {}
+	template<class U, size_t N, class = typename std_enable_if<(Extent == std_dynamic_extent || N == Extent) &&
+		std_is_convertible<U(*)[], T(*)[]>::value>::type>
+	constexpr std_span(const std_span<U, N>& other) : storage_(other.data(), other.size()) {}
+
+public:		/**** Member Functions ****/
+	constexpr iterator		begin() const { return storage_.data_; }
+	constexpr iterator		end() const { return storage_.data_ + size(); }
+	reference				front() const { assert(!empty()); return *storage_.data_; }
+	reference				back() const { assert(!empty()); return storage_.data_[size() - 1]; }
+	reference				operator[](size_type n) const { assert(n < size()); return storage_.data_[n]; }
+	constexpr pointer		data() const { return storage_.data_; }
+	constexpr size_type		size() const { return storage_.size(); }
+	constexpr size_type		size_bytes() const { return size() * sizeof(element_type); }
+	constexpr bool			empty() const { return size() == 0; }
+	// Returns a span over the first `Count' objects.
+	template<size_type Count>
+	std_span<T, Count>		first() const { assert(Count <= size()); return std_span<T, Count>(data(), Count); }
+	// Returns a span over the last `Count' objects.
+	template<size_type Count>
+	std_span<T, Count>		last() const { assert(Count <= size()); return std_span<T, Count>(end() - Count, Count); }
+	// Returns a span over `Count' objects, or all remaining objects, starting at `Offset'.
+	template<size_type Offset, size_type Count = std_dynamic_extent>
+	std_span<T, subspan_extent<Offset, Count>::value> subspan() const;
+	// Returns a span over the first `n' objects.
+	std_span<T>				first(size_type n) const { assert(n <= size()); return std_span<T>(data(), n); }
+	// Returns a span over the last `n' objects.
+	std_span<T>				last(size_type n) const { assert(n <= size()); return std_span<T>(end() - n, n); }
+	// Returns a span over `n' objects, or all remaining objects, starting at `offset'.
+	std_span<T>				subspan(size_type, size_type = std_dynamic_extent) const;
+
+private:	/**** Member Objects ****/
+	std_span_storage<T, Extent> storage_;	// Pointer to the first object and, if dynamic, the size.
+};
+
+# pragma endregion
+
+#pragma region std_span_member_functions
+
+template<class T, size_t Extent>
+template<size_t Offset, size_t Count>
+std_span<T, std_span<T, Extent>::template subspan_extent<Offset, Count>::value> std_span<T, Extent>::subspan() const
+{
+	assert(Offset <= size() && (Count == std_dynamic_extent || Count <= size() - Offset));
+
+	return std_span<T, subspan_extent<Offset, Count>::value>(
+		data() + Offset, Count == std_dynamic_extent ? size() - Offset : Count);
+}
+
+template<class T, size_t Extent>
+std_span<T> std_span<T, Extent>::subspan(size_type offset, size_type n) const
+{
+	assert(offset <= size() && (n == std_dynamic_extent || n <= size() - offset));
+
+	return std_span<T>(data() + offset, n == std_dynamic_extent ? size() - offset : n);
+}
+
+#pragma endregion
+
+#endif // !defined SPAN_H__
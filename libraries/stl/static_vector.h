@@ -0,0 +1,669 @@
+/*
+ *	This file defines a fixed-capacity, variable-size sequence container type.
+ *
+ *  ***************************************************************************
+ *
+ *	File: static_vector.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	**************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_static_vector' type, a sequence container
+ *		with the interface of the STL `std::vector' type, but whose elements
+ *		are stored inline in the object itself, in an uninitialized array of
+ *		capacity `N'. It never allocates memory, so it can be declared
+ *		statically or on the stack and can grow and shrink repeatedly without
+ *		fragmenting the heap. The type is modelled after the proposed C++26
+ *		`std::inplace_vector' and Boost `static_vector' types.
+ *
+ *		Elements are constructed when inserted and destroyed when erased,
+ *		unlike `std_array' and `ArrayWrapper' whose elements always exist.
+ *		The capacity is a compile-time constant and inserting into a full
+ *		container is a programming error: it fails the `assert()' and is
+ *		otherwise ignored.
+ *
+ *			std_static_vector<int, 8> v;
+ *			v.push_back(3);
+ *			v.emplace_back(1);
+ *			v.insert(v.begin(), 2);		// v = { 2, 3, 1 }
+ *			std_sort(v.begin(), v.end());	// v = { 1, 2, 3 }
+ *			v.erase(std_remove(v.begin(), v.end(), 2), v.end()); // v = { 1, 3 }
+ *
+ *		The iterators are simple pointers, so the container works with all
+ *		of the `std_' algorithms.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined STATIC_VECTOR_H__
+# define STATIC_VECTOR_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include "type_traits.h"		// `std_aligned_storage', `std_enable_if'.
+# include "uninitialized.h"		// Placement construction functions.
+# include "array.h"				// Reverse iterator types and algorithms.
+
+# pragma region std_static_vector
+
+// Fixed-capacity sequence container with inline storage.
+template<class T, size_t N>
+class std_static_vector
+{
+public:		/**** Member Types and Constants ****/
+	typedef std_static_vector<T, N> self_type;
+	typedef T value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef pointer iterator;
+	typedef const_pointer const_iterator;
+	typedef ReverseIterator<iterator> reverse_iterator;
+	typedef ConstReverseIterator<const_iterator> const_reverse_iterator;
+
+public:		/**** Ctors ****/
+	std_static_vector();
+	explicit std_static_vector(size_type);
+	std_static_vector(size_type, const_reference);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	std_static_vector(InputIt, InputIt);
+	std_static_vector(const self_type&);
+	std_static_vector(self_type&&);
+	~std_static_vector();
+
+	self_type& operator=(const self_type&);
+	self_type& operator=(self_type&&);
+
+public:		/**** Member Functions ****/
+	reference				at(size_type);
+	const_reference			at(size_type) const;
+	reference				operator[](size_type);
+	const_reference			operator[](size_type) const;
+	reference				front();
+	const_reference			front() const;
+	reference				back();
+	const_reference			back() const;
+	pointer					data();
+	const_pointer			data() const;
+	size_type				size() const;
+	static constexpr size_type max_size() { return N; }
+	static constexpr size_type capacity() { return N; }
+	bool					empty() const;
+	bool					full() const;
+	iterator				begin();
+	const_iterator			begin() const;
+	const_iterator			cbegin() const;
+	iterator				end();
+	const_iterator			end() const;
+	const_iterator			cend() const;
+	reverse_iterator		rbegin();
+	const_reverse_iterator	rbegin() const;
+	const_reverse_iterator	crbegin() const;
+	reverse_iterator		rend();
+	const_reverse_iterator	rend() const;
+	const_reverse_iterator	crend() const;
+	void					assign(size_type, const_reference);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	void					assign(InputIt, InputIt);
+	void					push_back(const_reference);
+	void					push_back(value_type&&);
+	template<class... Args>
+	reference				emplace_back(Args&&...);
+	void					pop_back();
+	iterator				insert(const_iterator, const_reference);
+	iterator				insert(const_iterator, value_type&&);
+	iterator				insert(const_iterator, size_type, const_reference);
+	template<class InputIt, class = typename std_enable_if<!std_is_integral<InputIt>::value>::type>
+	iterator				insert(const_iterator, InputIt, InputIt);
+	template<class... Args>
+	iterator				emplace(const_iterator, Args&&...);
+	iterator				erase(const_iterator);
+	iterator				erase(const_iterator, const_iterator);
+	void					resize(size_type);
+	void					resize(size_type, const_reference);
+	void					clear();
+	void					swap(self_type&);
+
+private:
+	// Opens an uninitialized gap of `n' elements at `pos' and returns its position.
+	iterator				open(const_iterator, size_type);
+
+private:	/**** Member Objects ****/
+	typedef typename std_aligned_storage<sizeof(T), alignof(T)>::type storage_type;
+
+	storage_type	data_[N == 0 ? 1U : N];	// Uninitialized element storage.
+	size_type		size_;					// Number of constructed elements.
+};
+
+# pragma endregion
+
+#pragma region std_static_vector_ctors
+
+template<class T, size_t N>
+std_static_vector<T, N>::std_static_vector() :
+	size_()
+{
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>::std_static_vector(size_type n) :
+	size_()
+{
+	resize(n);
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>::std_static_vector(size_type n, const_reference value) :
+	size_()
+{
+	resize(n, value);
+}
+
+template<class T, size_t N>
+template<class InputIt, class>
+std_static_vector<T, N>::std_static_vector(InputIt first, InputIt last) :
+	size_()
+{
+	assign(first, last);
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>::std_static_vector(const self_type& other) :
+	size_(other.size_)
+{
+	std_uninitialized_copy(other.begin(), other.end(), begin());
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>::std_static_vector(self_type&& other) :
+	size_(other.size_)
+{
+	std_uninitialized_move(other.begin(), other.end(), begin());
+	other.clear();
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>::~std_static_vector()
+{
+	clear();
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>& std_static_vector<T, N>::operator=(const self_type& other)
+{
+	if (this != &other)
+		assign(other.begin(), other.end());
+	return *this;
+}
+
+template<class T, size_t N>
+std_static_vector<T, N>& std_static_vector<T, N>::operator=(self_type&& other)
+{
+	if (this != &other)
+	{
+		clear();
+		std_uninitialized_move(other.begin(), other.end(), begin());
+		size_ = other.size_;
+		other.clear();
+	}
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region std_static_vector_member_functions
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::reference std_static_vector<T, N>::at(size_type n)
+{
+	assert(n < size_);
+	if (size_ <= n)
+		n = size_ ? size_ - 1U : 0U;	// An empty vector still has storage for one element.
+	return data()[n];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_reference std_static_vector<T, N>::at(size_type n) const
+{
+	assert(n < size_);
+	if (size_ <= n)
+		n = size_ ? size_ - 1U : 0U;	// An empty vector still has storage for one element.
+	return data()[n];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::reference std_static_vector<T, N>::operator[](size_type n)
+{
+	return data()[n];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_reference std_static_vector<T, N>::operator[](size_type n) const
+{
+	return data()[n];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::reference std_static_vector<T, N>::front()
+{
+	return data()[0];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_reference std_static_vector<T, N>::front() const
+{
+	return data()[0];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::reference std_static_vector<T, N>::back()
+{
+	return data()[size_ - 1U];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_reference std_static_vector<T, N>::back() const
+{
+	return data()[size_ - 1U];
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::pointer std_static_vector<T, N>::data()
+{
+	return reinterpret_cast<pointer>(data_);
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_pointer std_static_vector<T, N>::data() const
+{
+	return reinterpret_cast<const_pointer>(data_);
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::size_type std_static_vector<T, N>::size() const
+{
+	return size_;
+}
+
+template<class T, size_t N>
+bool std_static_vector<T, N>::empty() const
+{
+	return size_ == 0;
+}
+
+template<class T, size_t N>
+bool std_static_vector<T, N>::full() const
+{
+	return size_ == N;
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::iterator std_static_vector<T, N>::begin()
+{
+	return iterator(data());
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_iterator std_static_vector<T, N>::begin() const
+{
+	return const_iterator(data());
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_iterator std_static_vector<T, N>::cbegin() const
+{
+	return begin();
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::iterator std_static_vector<T, N>::end()
+{
+	return iterator(data() + size_);
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_iterator std_static_vector<T, N>::end() const
+{
+	return const_iterator(data() + size_);
+}
+
+template<class T, size_t N>
+typename std_static_vector<T, N>::const_iterator std_static_vector<T, N>::cend() const
+{
+	return end();
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::reverse_iterator
+		std_static_vector<T, N>::rbegin()
+{
+	return reverse_iterator(end());
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::const_reverse_iterator
+		std_static_vector<T, N>::rbegin() const
+{
+	return const_reverse_iterator(end());
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::const_reverse_iterator
+		std_static_vector<T, N>::crbegin() const
+{
+	return rbegin();
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::reverse_iterator
+		std_static_vector<T, N>::rend()
+{
+	return reverse_iterator(begin());
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::const_reverse_iterator
+		std_static_vector<T, N>::rend() const
+{
+	return const_reverse_iterator(begin());
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::const_reverse_iterator
+		std_static_vector<T, N>::crend() const
+{
+	return rend();
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::assign(size_type n, const_reference value)
+{
+	assert(n <= N);
+	clear();
+	resize(n, value);
+}
+
+template<class T, size_t N>
+template<class InputIt, class>
+void std_static_vector<T, N>::assign(InputIt first, InputIt last)
+{
+	clear();
+	for (; first != last && !full(); ++first)
+		emplace_back(*first);
+	assert(first == last);
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::push_back(const_reference value)
+{
+	emplace_back(value);
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::push_back(value_type&& value)
+{
+	emplace_back(std_move(value));
+}
+
+template<class T, size_t N>
+template<class... Args>
+typename std_static_vector<T, N>::reference std_static_vector<T, N>::emplace_back(Args&&... args)
+{
+	assert(!full());
+	if (full())
+		return data()[size_ ? size_ - 1U : 0U];	// A zero-capacity vector still has storage for one element.
+
+	pointer p = std_construct_at(end(), std_forward<Args>(args)...);
+	++size_;
+	return *p;
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::pop_back()
+{
+	assert(!empty());
+	if (!empty())
+		std_destroy_at(data() + --size_);
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::insert(const_iterator pos, const_reference value)
+{
+	return emplace(pos, value);
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::insert(const_iterator pos, value_type&& value)
+{
+	return emplace(pos, std_move(value));
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::insert(const_iterator pos, size_type n, const_reference value)
+{
+	// `value' may refer to an element that `open()' moves, so copy it first.
+	const value_type tmp(value);
+	iterator it = open(pos, n);
+
+	if (it != end() || n == 0)
+		std_uninitialized_fill_n(it, n, tmp);
+	return it;
+}
+
+template<class T, size_t N>
+template<class InputIt, class>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::insert(const_iterator pos, InputIt first, InputIt last)
+{
+	// Append then rotate into place, so single-pass iterators work.
+	const difference_type offset = pos - begin();
+	const size_type n = size_;
+
+	for (; first != last && !full(); ++first)
+		emplace_back(*first);
+	assert(first == last);
+	std_rotate(begin() + offset, begin() + n, end());
+	return begin() + offset;
+}
+
+template<class T, size_t N>
+template<class... Args>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::emplace(const_iterator pos, Args&&... args)
+{
+	assert(!full());
+	if (full())
+		return end();
+	if (pos == end())
+		return &emplace_back(std_forward<Args>(args)...);
+
+	// Construct first, since `args' may refer to an element that moves.
+	value_type tmp(std_forward<Args>(args)...);
+	iterator it = const_cast<iterator>(pos);
+
+	std_construct_at(end(), std_move(back()));
+	std_move_backward(it, end() - 1, end());
+	++size_;
+	*it = std_move(tmp);
+	return it;
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::erase(const_iterator pos)
+{
+	return erase(pos, pos + 1);
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::erase(const_iterator first, const_iterator last)
+{
+	iterator it = const_cast<iterator>(first);
+
+	if (first != last)
+	{
+		iterator new_end = std_move(const_cast<iterator>(last), end(), it);
+
+		std_destroy(new_end, end());
+		size_ = new_end - begin();
+	}
+	return it;
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::resize(size_type n)
+{
+	assert(n <= N);
+	if (n > N)
+		n = N;
+	if (n < size_)
+		std_destroy(begin() + n, end());
+	else
+		std_uninitialized_value_construct_n(end(), n - size_);
+	size_ = n;
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::resize(size_type n, const_reference value)
+{
+	assert(n <= N);
+	if (n > N)
+		n = N;
+	if (n < size_)
+		std_destroy(begin() + n, end());
+	else
+		std_uninitialized_fill_n(end(), n - size_, value);
+	size_ = n;
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::clear()
+{
+	std_destroy(begin(), end());
+	size_ = 0;
+}
+
+template<class T, size_t N>
+void std_static_vector<T, N>::swap(self_type& other)
+{
+	self_type tmp(std_move(other));
+
+	other = std_move(*this);
+	*this = std_move(tmp);
+}
+
+template<class T, size_t N>
+	typename std_static_vector<T, N>::iterator
+		std_static_vector<T, N>::open(const_iterator pos, size_type n)
+{
+	assert(size_ + n <= N);
+	if (size_ + n > N)
+		return end();
+	else if (n == 0)
+		return const_cast<iterator>(pos);	// Shifting by zero would self-move-assign the tail.
+
+	iterator it = const_cast<iterator>(pos);
+	const size_type tail = end() - it;
+
+	if (n <= tail)
+	{
+		// Move-construct the last `n' elements into raw storage, shift the
+		// rest back and destroy the moved-from elements to leave a raw gap.
+		std_uninitialized_move(end() - n, end(), end());
+		std_move_backward(it, end() - n, end());
+		std_destroy(it, it + n);
+	}
+	else
+	{
+		std_uninitialized_move(it, end(), it + n);
+		std_destroy(it, end());
+	}
+	size_ += n;
+	return it;
+}
+
+#pragma endregion
+
+#pragma region std_static_vector_non-member_functions
+
+template<class T, size_t N>
+void swap(std_static_vector<T, N>& lhs, std_static_vector<T, N>& rhs)
+{	// Swap the contents of two containers.
+	lhs.swap(rhs);
+}
+
+template<class T, size_t N>
+bool operator==(const std_static_vector<T, N>& lhs, const std_static_vector<T, N>& rhs)
+{	// Returns `true' if the contents of two containers are equal, else returns `false'.
+	return lhs.size() == rhs.size() && std_equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class T, size_t N>
+bool operator!=(const std_static_vector<T, N>& lhs, const std_static_vector<T, N>& rhs)
+{	// Returns `true' if the contents of two containers are not equal, else returns `false'.
+	return !(lhs == rhs);
+}
+
+template<class T, size_t N>
+bool operator<(const std_static_vector<T, N>& lhs, const std_static_vector<T, N>& rhs)
+{	// Returns `true' if the contents of container `lhs' is less than `rhs', else returns `false'.
+	return std_lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+// Erases all elements equal to `value' from container `c'.
+template<class T, size_t N, class U>
+typename std_static_vector<T, N>::size_type std_erase(std_static_vector<T, N>& c, const U& value)
+{
+	typename std_static_vector<T, N>::iterator it = std_remove(c.begin(), c.end(), value);
+	typename std_static_vector<T, N>::size_type n = c.end() - it;
+
+	c.erase(it, c.end());
+	return n;
+}
+
+// Erases all elements satisfying predicate `p' from container `c'.
+template<class T, size_t N, class UnaryPredicate>
+typename std_static_vector<T, N>::size_type std_erase_if(std_static_vector<T, N>& c, UnaryPredicate p)
+{
+	typename std_static_vector<T, N>::iterator it = std_remove_if(c.begin(), c.end(), p);
+	typename std_static_vector<T, N>::size_type n = c.end() - it;
+
+	c.erase(it, c.end());
+	return n;
+}
+
+#pragma endregion
+
+#endif // !defined STATIC_VECTOR_H__
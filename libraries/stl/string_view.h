@@ -0,0 +1,321 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) string view.
+ *
+ *	***************************************************************************
+ *
+ *	File: string_view.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_string_view' type from the C++17 <string_view>
+ *		header of a C++ Standard Template Library (STL) implementation. A
+ *		string view is a non-owning reference to a sequence of chars that
+ *		keeps the length alongside the pointer, so the text is measured once,
+ *		when the view is made, and never again. Views needn't be
+ *		null-terminated, which lets `substr()' and `remove_prefix()' slice a
+ *		buffer in place without copying it:
+ *
+ *			std_string_view cmd(serial_remote.text());
+ *			if (cmd.starts_with("sto"))
+ *				parse(cmd.substr(3));
+ *
+ *		Only the `char' specialization is provided, and out-of-range
+ *		positions are caught by `assert()' and clamped rather than thrown.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined STRING_VIEW_H__
+# define STRING_VIEW_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stddef.h>			// `size_t'.
+# include <string.h>			// `memcmp()', `memchr()', `memcpy()'.
+
+namespace
+{
+	// Compares `n' chars, which may be zero, in which case the pointers may be null.
+	inline bool std_char_equal(const char* a, const char* b, size_t n)
+	{
+		return n == 0 || !memcmp(a, b, n);
+	}
+}
+
+# pragma region std_string_view
+
+// Non-owning reference to a sequence of chars.
+class std_string_view
+{
+public:		/**** Member Types and Constants ****/
+	typedef char value_type;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef const char* pointer;
+	typedef const char* const_pointer;
+	typedef const char& reference;
+	typedef const char& const_reference;
+	typedef const char* iterator;
+	typedef const char* const_iterator;
+
+	static const size_type npos = size_type(-1);
+
+public:		/**** Ctors ****/
+	constexpr std_string_view() : data_(), size_() {}
+	constexpr std_string_view(const char* s, size_type n) : data_(s), size_(n) {}
+	// Measures `s' once, at compile time if `s' is a literal.
+	constexpr std_string_view(const char* s) : data_(s), size_(s ? __builtin_strlen(s) : 0) {}
+
+public:		/**** Member Functions ****/
+	constexpr const_iterator	begin() const { return data_; }
+	constexpr const_iterator	cbegin() const { return data_; }
+	constexpr const_iterator	end() const { return data_ + size_; }
+	constexpr const_iterator	cend() const { return data_ + size_; }
+	constexpr size_type			size() const { return size_; }
+	constexpr size_type			length() const { return size_; }
+	constexpr size_type			max_size() const { return npos - 1; }
+	constexpr bool				empty() const { return size_ == 0; }
+	constexpr const_reference	operator[](size_type pos) const { return data_[pos]; }
+	constexpr const_reference	front() const { return data_[0]; }
+	constexpr const_reference	back() const { return data_[size_ - 1]; }
+	constexpr const_pointer		data() const { return data_; }
+	void						remove_prefix(size_type);
+	void						remove_suffix(size_type);
+	void						swap(std_string_view&);
+	size_type					copy(char*, size_type, size_type = 0) const;
+	std_string_view				substr(size_type = 0, size_type = npos) const;
+	int							compare(std_string_view) const;
+	int							compare(size_type, size_type, std_string_view) const;
+	bool						starts_with(std_string_view) const;
+	bool						starts_with(char c) const { return size_ && data_[0] == c; }
+	bool						ends_with(std_string_view) const;
+	bool						ends_with(char c) const { return size_ && data_[size_ - 1] == c; }
+	size_type					find(std_string_view, size_type = 0) const;
+	size_type					find(char, size_type = 0) const;
+	size_type					rfind(std_string_view, size_type = npos) const;
+	size_type					rfind(char, size_type = npos) const;
+	size_type					find_first_of(std_string_view, size_type = 0) const;
+	size_type					find_first_not_of(std_string_view, size_type = 0) const;
+
+private:	/**** Member Objects ****/
+	const char*	data_;	// First char.
+	size_type	size_;	// Number of chars.
+};
+
+# pragma endregion
+
+#pragma region std_string_view_member_functions
+
+inline void std_string_view::remove_prefix(size_type n)
+{
+	assert(n <= size_);
+	if (n > size_)
+		n = size_;
+	data_ += n;
+	size_ -= n;
+}
+
+inline void std_string_view::remove_suffix(size_type n)
+{
+	assert(n <= size_);
+	size_ -= n > size_ ? size_ : n;
+}
+
+inline void std_string_view::swap(std_string_view& other)
+{
+	const char* d = data_; data_ = other.data_; other.data_ = d;
+	size_type n = size_; size_ = other.size_; other.size_ = n;
+}
+
+inline std_string_view::size_type std_string_view::copy(char* dest, size_type n, size_type pos) const
+{
+	std_string_view s = substr(pos, n);
+
+	if (s.size_)
+		memcpy(dest, s.data_, s.size_);
+
+	return s.size_;
+}
+
+inline std_string_view std_string_view::substr(size_type pos, size_type n) const
+{
+	assert(pos <= size_);
+	if (pos > size_)
+		pos = size_;
+
+	return std_string_view(data_ + pos, n < size_ - pos ? n : size_ - pos);
+}
+
+inline int std_string_view::compare(std_string_view other) const
+{
+	const size_type n = size_ < other.size_ ? size_ : other.size_;
+	const int result = n ? memcmp(data_, other.data_, n) : 0;
+
+	return result ? result : (size_ < other.size_ ? -1 : size_ > other.size_ ? 1 : 0);
+}
+
+inline int std_string_view::compare(size_type pos, size_type n, std_string_view other) const
+{
+	return substr(pos, n).compare(other);
+}
+
+inline bool std_string_view::starts_with(std_string_view s) const
+{
+	return size_ >= s.size_ && std_char_equal(data_, s.data_, s.size_);
+}
+
+inline bool std_string_view::ends_with(std_string_view s) const
+{
+	return size_ >= s.size_ && std_char_equal(data_ + size_ - s.size_, s.data_, s.size_);
+}
+
+inline std_string_view::size_type std_string_view::find(std_string_view s, size_type pos) const
+{
+	if (pos > size_ || s.size_ > size_ - pos)
+		return npos;
+	if (s.empty())
+		return pos;
+
+	// Let `memchr()' skip to each candidate first char, then compare the rest.
+	const char* last = data_ + size_ - s.size_ + 1;
+
+	for (const char* p = data_ + pos; p < last; ++p)
+	{
+		p = static_cast<const char*>(memchr(p, s.data_[0], last - p));
+		if (!p)
+			break;
+		if (!memcmp(p + 1, s.data_ + 1, s.size_ - 1))
+			return p - data_;
+	}
+
+	return npos;
+}
+
+inline std_string_view::size_type std_string_view::find(char c, size_type pos) const
+{
+	if (pos >= size_)
+		return npos;
+
+	const char* p = static_cast<const char*>(memchr(data_ + pos, c, size_ - pos));
+
+	return p ? p - data_ : npos;
+}
+
+inline std_string_view::size_type std_string_view::rfind(std_string_view s, size_type pos) const
+{
+	if (s.size_ > size_)
+		return npos;
+
+	size_type i = size_ - s.size_ < pos ? size_ - s.size_ : pos;
+
+	do
+	{
+		if (std_char_equal(data_ + i, s.data_, s.size_))
+			return i;
+	} while (i-- != 0);
+
+	return npos;
+}
+
+inline std_string_view::size_type std_string_view::rfind(char c, size_type pos) const
+{
+	if (empty())
+		return npos;
+
+	size_type i = size_ - 1 < pos ? size_ - 1 : pos;
+
+	do
+	{
+		if (data_[i] == c)
+			return i;
+	} while (i-- != 0);
+
+	return npos;
+}
+
+inline std_string_view::size_type std_string_view::find_first_of(std_string_view s, size_type pos) const
+{
+	for (; pos < size_; ++pos)
+		if (s.size_ && memchr(s.data_, data_[pos], s.size_))
+			return pos;
+
+	return npos;
+}
+
+inline std_string_view::size_type std_string_view::find_first_not_of(std_string_view s, size_type pos) const
+{
+	for (; pos < size_; ++pos)
+		if (!s.size_ || !memchr(s.data_, data_[pos], s.size_))
+			return pos;
+
+	return npos;
+}
+
+#pragma endregion
+
+#pragma region std_string_view_non-member_functions
+
+inline bool operator==(std_string_view lhs, std_string_view rhs)
+{	// Returns true if both views refer to equal text.
+	return lhs.size() == rhs.size() && std_char_equal(lhs.data(), rhs.data(), lhs.size());
+}
+
+inline bool operator!=(std_string_view lhs, std_string_view rhs)
+{	// Returns true if the views refer to unequal text.
+	return !(lhs == rhs);
+}
+
+inline bool operator<(std_string_view lhs, std_string_view rhs)
+{	// Returns true if `lhs' lexicographically precedes `rhs'.
+	return lhs.compare(rhs) < 0;
+}
+
+inline bool operator<=(std_string_view lhs, std_string_view rhs)
+{	// Returns true if `lhs' does not lexicographically follow `rhs'.
+	return lhs.compare(rhs) <= 0;
+}
+
+inline bool operator>(std_string_view lhs, std_string_view rhs)
+{	// Returns true if `lhs' lexicographically follows `rhs'.
+	return lhs.compare(rhs) > 0;
+}
+
+inline bool operator>=(std_string_view lhs, std_string_view rhs)
+{	// Returns true if `lhs' does not lexicographically precede `rhs'.
+	return lhs.compare(rhs) >= 0;
+}
+
+inline void swap(std_string_view& lhs, std_string_view& rhs)
+{	// Swaps two views.
+	lhs.swap(rhs);
+}
+
+#pragma endregion
+
+#endif // !defined STRING_VIEW_H__
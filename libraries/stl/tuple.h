@@ -0,0 +1,384 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) fixed-size
+ *	collection of heterogeneous values.
+ *
+ *	***************************************************************************
+ *
+ *	File: tuple.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_tuple' type and its helpers from the C++11
+ *		<tuple> header of a C++ Standard Template Library (STL)
+ *		implementation. A tuple holds one value of each of its types `Ts...',
+ *		like a struct whose members are numbered instead of named, which
+ *		lets generic code visit them in turn:
+ *
+ *			std_tuple<uint8_t, int16_t, std_fixed_string<8>> rec(1, -2, "name");
+ *
+ *			std_get<1>(rec) = 10;
+ *			std_tuple_for_each(rec, printer);	// Calls printer(uint8_t&), printer(int16_t&), ...
+ *			std_apply(write_record, rec);		// Calls write_record(1, 10, "name").
+ *
+ *		`std_tie()' returns a tuple of references to its arguments, which
+ *		describes the members of an existing struct as a single field list
+ *		that serialization and formatting code can iterate over, and unpacks
+ *		tuples by assignment:
+ *
+ *			struct config_t { uint8_t id; int16_t offset; };
+ *
+ *			auto fields(config_t& c) -> decltype(std_tie(c.id, c.offset)) { return std_tie(c.id, c.offset); }
+ *
+ *			stream << fields(config);	// Writes each member with its own overload.
+ *			std_tie(id, std_ignore) = rec;
+ *
+ *		Every index is resolved at compile time, so `std_get()',
+ *		`std_apply()' and `std_tuple_for_each()' inline to plain member
+ *		accesses and calls, with no loops or tables.
+ *
+ *		`std_tuple_for_each()' is not part of the Standard. `std_make_tuple()'
+ *		doesn't unwrap reference wrappers, and tuples have no allocator
+ *		constructors, `std_tuple_cat()' or access by type.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined TUPLE_H__
+# define TUPLE_H__ 20261018L
+
+# include <stddef.h>			// `size_t'.
+# include "type_traits.h"		// `std_decay', `std_enable_if', `std_is_same'.
+# include "utility.h"			// `std_forward()', `std_move()', `std_index_sequence'.
+
+template<class... Ts>
+class std_tuple;
+
+namespace
+{
+	// Type at index `I' of `Ts...'.
+	template<size_t I, class... Ts>
+	struct std_tuple_type_at;
+
+	template<class T, class... Ts>
+	struct std_tuple_type_at<0, T, Ts...> { typedef T type; };
+
+	template<size_t I, class T, class... Ts>
+	struct std_tuple_type_at<I, T, Ts...> : std_tuple_type_at<I - 1, Ts...> {};
+
+	// Storage of the tuple element at index `I'.
+	template<size_t I, class T>
+	struct std_tuple_leaf
+	{
+		std_tuple_leaf() : value() {}
+		template<class U>
+		explicit std_tuple_leaf(U&& u) : value(std_forward<U>(u)) {}
+
+		T value;
+	};
+
+	// Storage of all tuple elements, one base class per element.
+	template<class Seq, class... Ts>
+	struct std_tuple_impl;
+
+	template<size_t... I, class... Ts>
+	struct std_tuple_impl<std_index_sequence<I...>, Ts...> : std_tuple_leaf<I, Ts>...
+	{
+		std_tuple_impl() = default;
+		template<class... Us>
+		explicit std_tuple_impl(Us&&... us) : std_tuple_leaf<I, Ts>(std_forward<Us>(us))... {}
+	};
+
+	// Whether the arguments `Us...' are a single tuple of type `Self', to be copied rather than converted.
+	template<class Self, class... Us>
+	struct std_tuple_is_self : std_false_type {};
+
+	template<class Self, class U>
+	struct std_tuple_is_self<Self, U> : std_is_same<typename std_decay<U>::type, Self> {};
+
+	// Access to a tuple's storage.
+	struct std_tuple_access
+	{
+		template<size_t I, class T>
+		static T& get(std_tuple_leaf<I, T>& leaf) { return leaf.value; }
+		template<size_t I, class T>
+		static const T& get(const std_tuple_leaf<I, T>& leaf) { return leaf.value; }
+		template<class Tuple>
+		static auto impl(Tuple& t) -> decltype((t.impl_)) { return t.impl_; }
+	};
+}
+
+// Number of elements in a tuple.
+template<class T>
+struct std_tuple_size;
+
+template<class... Ts>
+struct std_tuple_size<std_tuple<Ts...>> : std_integral_constant<size_t, sizeof...(Ts)> {};
+
+template<class T>
+struct std_tuple_size<const T> : std_tuple_size<T> {};
+
+// Type of the `I'th element of a tuple.
+template<size_t I, class T>
+struct std_tuple_element;
+
+template<size_t I, class... Ts>
+struct std_tuple_element<I, std_tuple<Ts...>> : std_tuple_type_at<I, Ts...> {};
+
+template<size_t I, class T>
+struct std_tuple_element<I, const T> { typedef const typename std_tuple_element<I, T>::type type; };
+
+template<size_t I, class... Ts>
+typename std_tuple_element<I, std_tuple<Ts...>>::type& std_get(std_tuple<Ts...>&);
+
+template<size_t I, class... Ts>
+const typename std_tuple_element<I, std_tuple<Ts...>>::type& std_get(const std_tuple<Ts...>&);
+
+template<size_t I, class... Ts>
+typename std_tuple_element<I, std_tuple<Ts...>>::type&& std_get(std_tuple<Ts...>&&);
+
+// Placeholder that discards the value assigned to it through `std_tie()'.
+struct std_ignore_t
+{
+	template<class T>
+	const std_ignore_t& operator=(const T&) const { return *this; }
+};
+
+constexpr std_ignore_t std_ignore{};
+
+# pragma region std_tuple
+
+// Fixed-size collection of one value of each of the types `Ts...'.
+template<class... Ts>
+class std_tuple
+{
+	friend struct ::std_tuple_access;
+
+public:		/**** Member Types and Constants ****/
+	typedef std_tuple<Ts...> self_type;
+
+private:
+	typedef std_index_sequence_for<Ts...> indices;
+
+public:		/**** Ctors ****/
+	std_tuple() : impl_() {}
+	// Constructs each element from the corresponding argument.
+	template<class... Us, class = typename std_enable_if<
+		sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0 && !std_tuple_is_self<self_type, Us...>::value>::type>
+	std_tuple(Us&&... values) : impl_(std_forward<Us>(values)...) {}
+	std_tuple(const self_type&) = default;
+	std_tuple(self_type&&) = default;
+
+	// Assigns each element, through references as well.
+	self_type& operator=(const self_type& other) { assign(other, indices()); return *this; }
+	template<class... Us>
+	self_type& operator=(const std_tuple<Us...>&);
+
+private:
+	template<class Tuple, size_t... I>
+	void assign(const Tuple&, std_index_sequence<I...>);
+
+private:	/**** Member Objects ****/
+	std_tuple_impl<indices, Ts...> impl_;	// The elements.
+};
+
+# pragma endregion
+
+#pragma region std_tuple_member_functions
+
+template<class... Ts>
+template<class... Us>
+typename std_tuple<Ts...>::self_type& std_tuple<Ts...>::operator=(const std_tuple<Us...>& other)
+{
+	static_assert(sizeof...(Us) == sizeof...(Ts), "std_tuple assigned from a tuple of a different size.");
+	assign(other, indices());
+
+	return *this;
+}
+
+template<class... Ts>
+template<class Tuple, size_t... I>
+void std_tuple<Ts...>::assign(const Tuple& other, std_index_sequence<I...>)
+{
+	// The elements of a braced list are evaluated in order.
+	int expand[] = { 0, ((void)(std_get<I>(*this) = std_get<I>(other)), 0)... };
+
+	(void)expand;
+}
+
+#pragma endregion
+
+#pragma region std_tuple_functions
+
+// Returns a reference to the `I'th element of a tuple.
+template<size_t I, class... Ts>
+typename std_tuple_element<I, std_tuple<Ts...>>::type& std_get(std_tuple<Ts...>& t)
+{
+	return std_tuple_access::get<I>(std_tuple_access::impl(t));
+}
+
+template<size_t I, class... Ts>
+const typename std_tuple_element<I, std_tuple<Ts...>>::type& std_get(const std_tuple<Ts...>& t)
+{
+	return std_tuple_access::get<I>(std_tuple_access::impl(t));
+}
+
+template<size_t I, class... Ts>
+typename std_tuple_element<I, std_tuple<Ts...>>::type&& std_get(std_tuple<Ts...>&& t)
+{
+	return std_forward<typename std_tuple_element<I, std_tuple<Ts...>>::type>(std_get<I>(t));
+}
+
+// Returns a tuple holding copies of its arguments.
+template<class... Ts>
+std_tuple<typename std_decay<Ts>::type...> std_make_tuple(Ts&&... values)
+{
+	return std_tuple<typename std_decay<Ts>::type...>(std_forward<Ts>(values)...);
+}
+
+// Returns a tuple of references to its arguments.
+template<class... Ts>
+std_tuple<Ts&...> std_tie(Ts&... values)
+{
+	return std_tuple<Ts&...>(values...);
+}
+
+// Returns a tuple of forwarding references to its arguments.
+template<class... Ts>
+std_tuple<Ts&&...> std_forward_as_tuple(Ts&&... values)
+{
+	return std_tuple<Ts&&...>(std_forward<Ts>(values)...);
+}
+
+namespace
+{
+	template<class F, class Tuple, size_t... I>
+	auto std_apply_impl(F&& f, Tuple&& t, std_index_sequence<I...>)
+		-> decltype(std_forward<F>(f)(std_get<I>(std_forward<Tuple>(t))...))
+	{
+		return std_forward<F>(f)(std_get<I>(std_forward<Tuple>(t))...);
+	}
+
+	template<class Tuple, class F, size_t... I>
+	void std_tuple_for_each_impl(Tuple& t, F& f, std_index_sequence<I...>)
+	{
+		int expand[] = { 0, ((void)f(std_get<I>(t)), 0)... };
+
+		(void)expand;
+	}
+
+	// Compares the elements of two tuples from index `I' on.
+	template<size_t I, size_t N>
+	struct std_tuple_compare
+	{
+		template<class T, class U>
+		static bool equal(const T& a, const U& b)
+		{
+			return std_get<I>(a) == std_get<I>(b) && std_tuple_compare<I + 1, N>::equal(a, b);
+		}
+
+		template<class T, class U>
+		static bool less(const T& a, const U& b)
+		{
+			return std_get<I>(a) < std_get<I>(b) ||
+				(!(std_get<I>(b) < std_get<I>(a)) && std_tuple_compare<I + 1, N>::less(a, b));
+		}
+	};
+
+	template<size_t N>
+	struct std_tuple_compare<N, N>
+	{
+		template<class T, class U>
+		static bool equal(const T&, const U&) { return true; }
+		template<class T, class U>
+		static bool less(const T&, const U&) { return false; }
+	};
+}
+
+// Calls `f' with the elements of a tuple as arguments, returns the result.
+template<class F, class Tuple>
+auto std_apply(F&& f, Tuple&& t) -> decltype(std_apply_impl(std_forward<F>(f), std_forward<Tuple>(t),
+	std_make_index_sequence<std_tuple_size<typename std_remove_reference<Tuple>::type>::value>()))
+{
+	return std_apply_impl(std_forward<F>(f), std_forward<Tuple>(t),
+		std_make_index_sequence<std_tuple_size<typename std_remove_reference<Tuple>::type>::value>());
+}
+
+// Calls `f' with each element of a tuple in turn, in order, returns `f'.
+template<class Tuple, class F>
+F std_tuple_for_each(Tuple&& t, F f)
+{
+	std_tuple_for_each_impl(t, f, std_make_index_sequence<std_tuple_size<typename std_remove_reference<Tuple>::type>::value>());
+
+	return f;
+}
+
+template<class... Ts, class... Us>
+bool operator==(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	static_assert(sizeof...(Ts) == sizeof...(Us), "std_tuple compared with a tuple of a different size.");
+
+	return std_tuple_compare<0, sizeof...(Ts)>::equal(lhs, rhs);
+}
+
+template<class... Ts, class... Us>
+bool operator!=(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template<class... Ts, class... Us>
+bool operator<(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	static_assert(sizeof...(Ts) == sizeof...(Us), "std_tuple compared with a tuple of a different size.");
+
+	return std_tuple_compare<0, sizeof...(Ts)>::less(lhs, rhs);
+}
+
+template<class... Ts, class... Us>
+bool operator>(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	return rhs < lhs;
+}
+
+template<class... Ts, class... Us>
+bool operator<=(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	return !(rhs < lhs);
+}
+
+template<class... Ts, class... Us>
+bool operator>=(const std_tuple<Ts...>& lhs, const std_tuple<Us...>& rhs)
+{
+	return !(lhs < rhs);
+}
+
+#pragma endregion
+
+#endif // !defined TUPLE_H__
@@ -450,6 +450,22 @@ template<class T>
 typename std_add_rvalue_reference<T>::type std_declval();
 //typename std_add_rvalue_reference<T>::type std_declval() { return typename std_add_rvalue_reference<T>::type(); };
 
+namespace {
+
+	template <class To>
+	void convert_to(To);
+
+	template <class From, class To, class = decltype(convert_to<To>(std_declval<From>()))>
+	std_true_type try_convert(int);
+	template <class From, class To>
+	std_false_type try_convert(...);
+
+} // namespace
+
+// Checks whether `From' is implicitly convertible to `To', which must not be `void'.
+template <class From, class To>
+struct std_is_convertible : decltype(try_convert<From, To>(0)) {};
+
 // primary template (used for zero types)
 template <class...>
 struct std_common_type {};
@@ -508,4 +524,28 @@ template< class T > struct std_remove_pointer<T* const> { typedef T type; };
 template< class T > struct std_remove_pointer<T* volatile> { typedef T type; };
 template< class T > struct std_remove_pointer<T* const volatile> { typedef T type; };
 
+// The following traits require compiler support and are implemented with the 
+// GCC type-trait builtins.
+
+template<class T>
+struct std_is_trivially_copyable : public std_integral_constant<bool, __is_trivially_copyable(T)> {};
+
+template<class T>
+struct std_is_trivially_destructible : public std_integral_constant<bool, __has_trivial_destructor(T)> {};
+
+template<class T>
+struct std_is_trivial : public std_integral_constant<bool, __is_trivial(T)> {};
+
+template<class T>
+struct std_is_pod : public std_integral_constant<bool, __is_pod(T)> {};
+
+// Provides the nested type `type', a trivial type suitable for use as 
+// uninitialized storage for any object whose size is at most `Len' and whose 
+// alignment requirement is a divisor of `Align'.
+template<size_t Len, size_t Align = alignof(max_align_t)>
+struct std_aligned_storage 
+{
+	struct type { alignas(Align) unsigned char data_[Len]; };
+};
+
 #endif // !defined TYPE_TRAITS_H__
\ No newline at end of file
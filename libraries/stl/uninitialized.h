@@ -0,0 +1,155 @@
+/*
+ *	This file defines several C++ Standard Template Library (STL) functions for
+ *	constructing and destroying objects in uninitialized memory.
+ *
+ *	***************************************************************************
+ *
+ *	File: uninitialized.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the uninitialized memory functions from the <memory>
+ *		header of a C++ Standard Template Library (STL) implementation. They
+ *		construct objects in place, using placement `new', and destroy them
+ *		by calling the destructor explicitly, and are the building blocks for
+ *		containers that manage their own fixed-size storage. The functions
+ *		behave according to the ISO C++11 Standard: (ISO/IEC 14882:2011),
+ *		except that `std_construct_at' and `std_destroy*' are from C++17/20.
+ *
+ *		The file is named "uninitialized.h" rather than "memory.h" to avoid
+ *		a naming conflict with the cstdlib file <memory.h>.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard function names are
+ *		preceded by `std_'. Thus, for example:
+ *
+ *			std::find = std_find,
+ *			std::begin = std_begin,
+ *			std::end = std_end,
+ *
+ *		and so forth. Otherwise function names are identical to those defined
+ *		by the Standard.
+ *
+ *	**************************************************************************/
+
+#if !defined UNINITIALIZED_H__
+# define UNINITIALIZED_H__ 20261018L
+
+# if defined ARDUINO
+#  include <new.h>		// Placement `new'.
+# else
+#  include <new>		// Placement `new'.
+# endif
+# include "iterator.h"	// `std_iterator_traits', `std_addressof()'.
+# include "utility.h"	// `std_move()', `std_forward()'.
+
+// Constructs an object of type `T' from `args' at address `p'.
+template<class T, class... Args>
+T* std_construct_at(T* p, Args&&... args)
+{
+	return ::new (static_cast<void*>(p)) T(std_forward<Args>(args)...);
+}
+
+// Calls the destructor of the object pointed to by `p'.
+template<class T>
+void std_destroy_at(T* p)
+{
+	p->~T();
+}
+
+// Destroys the objects in the range [first, last).
+template<class ForwardIt>
+void std_destroy(ForwardIt first, ForwardIt last)
+{
+	for (; first != last; ++first)
+		std_destroy_at(std_addressof(*first));
+}
+
+// Destroys the first `n' objects in the range starting at `first'.
+template<class ForwardIt, class Size>
+ForwardIt std_destroy_n(ForwardIt first, Size n)
+{
+	for (; n > 0; (void)++first, --n)
+		std_destroy_at(std_addressof(*first));
+	return first;
+}
+
+// Copies the range [first, last) to the uninitialized memory at `dest'.
+template<class InputIt, class ForwardIt>
+ForwardIt std_uninitialized_copy(InputIt first, InputIt last, ForwardIt dest)
+{
+	typedef typename std_iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; first != last; ++first, (void)++dest)
+		::new (static_cast<void*>(std_addressof(*dest))) value_type(*first);
+	return dest;
+}
+
+// Moves the range [first, last) to the uninitialized memory at `dest'.
+template<class InputIt, class ForwardIt>
+ForwardIt std_uninitialized_move(InputIt first, InputIt last, ForwardIt dest)
+{
+	typedef typename std_iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; first != last; ++first, (void)++dest)
+		::new (static_cast<void*>(std_addressof(*dest))) value_type(std_move(*first));
+	return dest;
+}
+
+// Copies `value' to the uninitialized memory in the range [first, last).
+template<class ForwardIt, class T>
+void std_uninitialized_fill(ForwardIt first, ForwardIt last, const T& value)
+{
+	typedef typename std_iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; first != last; ++first)
+		::new (static_cast<void*>(std_addressof(*first))) value_type(value);
+}
+
+// Copies `value' to the first `n' elements of the uninitialized memory at `first'.
+template<class ForwardIt, class Size, class T>
+ForwardIt std_uninitialized_fill_n(ForwardIt first, Size n, const T& value)
+{
+	typedef typename std_iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; n > 0; ++first, (void)--n)
+		::new (static_cast<void*>(std_addressof(*first))) value_type(value);
+	return first;
+}
+
+// Value-initializes `n' objects in the uninitialized memory at `first'.
+template<class ForwardIt, class Size>
+ForwardIt std_uninitialized_value_construct_n(ForwardIt first, Size n)
+{
+	typedef typename std_iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; n > 0; ++first, (void)--n)
+		::new (static_cast<void*>(std_addressof(*first))) value_type();
+	return first;
+}
+
+#endif // !defined UNINITIALIZED_H__
@@ -70,6 +70,25 @@
 //	b = tmp;
 //}
 
+template <class T>
+inline T&& std_forward(typename std_remove_reference<T>::type& t) 
+{
+	return static_cast<T&&>(t);
+}
+
+template <class T>  
+inline T&& std_forward(typename std_remove_reference<T>::type&& t)
+{
+	return static_cast<T&&>(t);
+}
+
+template <class T> 
+inline typename std_remove_reference<T>::type&& 
+	std_move(T&& t)
+{
+	return static_cast<typename std_remove_reference<T>::type&&>(t);
+}
+
 template<class T>
 void std_swap(T& a, T& b)
 {
@@ -91,25 +110,6 @@ void std_swap(T (&a)[N], T (&b)[N])
 	}
 }
 
-template <class T>
-inline T&& std_forward(typename std_remove_reference<T>::type& t) 
-{
-	return static_cast<T&&>(t);
-}
-
-template <class T>  
-inline T&& std_forward(typename std_remove_reference<T>::type&& t)
-{
-	return static_cast<T&&>(t);
-}
-
-template <class T> 
-inline typename std_remove_reference<T>::type&& 
-	std_move(T&& t)
-{
-	return static_cast<typename std_remove_reference<T>::type&&>(t);
-}
-
 // In TYPE_TRAITS.H
 //
 //template<class T>
@@ -123,6 +123,16 @@ typename std_remove_reference<T>::type&& move(T&& arg)
 
 struct std_piecewise_construct_t { explicit std_piecewise_construct_t() = default; };
 
+// Disambiguation tags for in-place construction of `std_optional' and `std_variant' contents.
+struct std_in_place_t { explicit std_in_place_t() = default; };
+constexpr std_in_place_t std_in_place{};
+
+template<class T>
+struct std_in_place_type_t { explicit std_in_place_type_t() = default; };
+
+template<size_t I>
+struct std_in_place_index_t { explicit std_in_place_index_t() = default; };
+
 template<class T1, class T2>
 struct std_pair
 {
@@ -130,12 +140,12 @@ struct std_pair
 	typedef T1 first_type;
 	typedef T2 second_type;
 
-	std_pair() :
+	constexpr std_pair() :
 		first(), second()
 	{	
 	}
 
-	std_pair(const T1& value_1, const T2& value_2) :
+	constexpr std_pair(const T1& value_1, const T2& value_2) :
 		first(value_1), second(value_2)
 	{	
 	}
@@ -217,4 +227,29 @@ std_pair<T1, T2> std_make_pair(T1 t1, T2 t2)
 	return (std_pair<T1, T2>(t1, t2));
 }
 
+// Compile-time sequence of `size_t' indices.
+template<size_t... I>
+struct std_index_sequence
+{
+	typedef size_t value_type;
+	static constexpr size_t size() { return sizeof...(I); }
+};
+
+namespace
+{
+	template<size_t N, size_t... I>
+	struct std_make_index_sequence_impl : std_make_index_sequence_impl<N - 1, N - 1, I...> {};
+
+	template<size_t... I>
+	struct std_make_index_sequence_impl<0, I...> { typedef std_index_sequence<I...> type; };
+}
+
+// Generates the index sequence 0, 1, ..., N - 1.
+template<size_t N>
+using std_make_index_sequence = typename std_make_index_sequence_impl<N>::type;
+
+// Generates the index sequence 0, 1, ..., sizeof...(T) - 1.
+template<class... T>
+using std_index_sequence_for = std_make_index_sequence<sizeof...(T)>;
+
 #endif // !defined UTILITY_H__
\ No newline at end of file
@@ -0,0 +1,482 @@
+/*
+ *	This file defines a C++ Standard Template Library (STL) type-safe union.
+ *
+ *	***************************************************************************
+ *
+ *	File: variant.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *		This file defines the `std_variant' type and its helpers from the
+ *		C++17 <variant> header of a C++ Standard Template Library (STL)
+ *		implementation. A variant holds exactly one value whose type is one
+ *		of its alternatives `Ts...', stored inline in space large enough for
+ *		the biggest of them, along with a one-byte index saying which one it
+ *		is. Unlike a class hierarchy, a variant needs no heap, vtable or
+ *		virtual calls, which makes it a good fit for messages and commands
+ *		whose set of types is known up front:
+ *
+ *			struct Move { angle_t angle; };
+ *			struct Stop {};
+ *			typedef std_variant<Move, Stop> message_type;
+ *
+ *			std_visit(handler, msg);	// Calls handler(Move&) or handler(Stop&).
+ *
+ *		`std_visit()' dispatches through a table of function pointers built
+ *		at compile time and indexed by the variant's index, so a visit costs
+ *		one indirect call regardless of the number of alternatives. Only a
+ *		single variant may be visited at a time, and every overload of the
+ *		visitor must return the same type.
+ *
+ *		Converting construction and assignment require the argument's type
+ *		to be exactly one of the alternatives, after removing references and
+ *		cv-qualifiers. Without exceptions a variant can never become
+ *		valueless, and accessing the wrong alternative through `std_get()'
+ *		is caught by `assert()' instead of throwing `bad_variant_access'.
+ *
+ *		The Standard requires that STL objects reside in the `std' namespace.
+ *		However, because later implementations of the Arduino IDE lack
+ *		namespace support, this entire library resides in the global namespace
+ *		and, to avoid naming collisions, all standard object names are
+ *		preceded by `std_'.
+ *
+ *	**************************************************************************/
+
+#if !defined VARIANT_H__
+# define VARIANT_H__ 20261018L
+
+# include <assert.h>			// `assert()' macro.
+# include <stddef.h>			// `size_t'.
+# include <stdint.h>			// `uint8_t'.
+# include "type_traits.h"		// `std_aligned_storage', `std_decay', `std_enable_if'.
+# include "utility.h"			// `std_move()', `std_forward()', `std_in_place_*_t', `std_index_sequence'.
+# include "uninitialized.h"		// `std_construct_at()', `std_destroy_at()'.
+
+// Alternative that makes a variant default constructible, or represents "no value".
+struct std_monostate {};
+
+// Index returned for a type that is not one of a variant's alternatives.
+constexpr size_t std_variant_npos = size_t(-1);
+
+template<class... Ts>
+class std_variant;
+
+namespace
+{
+	// Index of `T' in `Ts...', or sizeof...(Ts) if it isn't one of them.
+	template<class T, class... Ts>
+	struct std_variant_index_of : std_integral_constant<size_t, 0> {};
+
+	template<class T, class U, class... Ts>
+	struct std_variant_index_of<T, U, Ts...> :
+		std_integral_constant<size_t, std_is_same<T, U>::value ? 0 : 1 + std_variant_index_of<T, Ts...>::value> {};
+
+	// Type at index `I' of `Ts...'.
+	template<size_t I, class... Ts>
+	struct std_variant_type_at;
+
+	template<class T, class... Ts>
+	struct std_variant_type_at<0, T, Ts...> { typedef T type; };
+
+	template<size_t I, class T, class... Ts>
+	struct std_variant_type_at<I, T, Ts...> : std_variant_type_at<I - 1, Ts...> {};
+
+	// Largest of `N...'.
+	template<size_t... N>
+	struct std_variant_max : std_integral_constant<size_t, 0> {};
+
+	template<size_t N, size_t... Ns>
+	struct std_variant_max<N, Ns...> :
+		std_integral_constant<size_t, (N > std_variant_max<Ns...>::value ? N : std_variant_max<Ns...>::value)> {};
+
+	// Unchecked access to a variant's storage.
+	struct std_variant_access
+	{
+		template<class T, class V>
+		static T& get(V& v) { return *reinterpret_cast<T*>(&v.storage_); }
+		template<class T, class V>
+		static const T& get(const V& v) { return *reinterpret_cast<const T*>(&v.storage_); }
+	};
+}
+
+// Number of alternatives in a variant.
+template<class V>
+struct std_variant_size;
+
+template<class... Ts>
+struct std_variant_size<std_variant<Ts...>> : std_integral_constant<size_t, sizeof...(Ts)> {};
+
+template<class V>
+struct std_variant_size<const V> : std_variant_size<V> {};
+
+// Type of the `I'th alternative of a variant.
+template<size_t I, class V>
+struct std_variant_alternative;
+
+template<size_t I, class... Ts>
+struct std_variant_alternative<I, std_variant<Ts...>> : std_variant_type_at<I, Ts...> {};
+
+template<size_t I, class V>
+struct std_variant_alternative<I, const V> { typedef const typename std_variant_alternative<I, V>::type type; };
+
+# pragma region std_variant
+
+// Type-safe union of the types `Ts...'.
+template<class... Ts>
+class std_variant
+{
+	static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) < 255, "std_variant must have between 1 and 254 alternatives.");
+
+	friend struct ::std_variant_access;
+
+public:		/**** Member Types and Constants ****/
+	typedef std_variant<Ts...> self_type;
+	typedef uint8_t index_type;
+
+private:
+	typedef typename std_aligned_storage<std_variant_max<sizeof(Ts)...>::value,
+		std_variant_max<alignof(Ts)...>::value>::type storage_type;
+
+	template<class T>
+	using index_of = std_variant_index_of<typename std_decay<T>::type, Ts...>;
+
+	template<size_t I>
+	using type_at = typename std_variant_type_at<I, Ts...>::type;
+
+	// Type-erased operations on the alternative `T', one table entry per alternative.
+	template<class T>
+	struct Ops
+	{
+		static void destroy(void* p) { std_destroy_at(static_cast<T*>(p)); }
+		static void copy(void* dest, const void* src) { std_construct_at(static_cast<T*>(dest), *static_cast<const T*>(src)); }
+		static void move(void* dest, void* src) { std_construct_at(static_cast<T*>(dest), std_move(*static_cast<T*>(src))); }
+		static void copy_assign(void* dest, const void* src) { *static_cast<T*>(dest) = *static_cast<const T*>(src); }
+		static void move_assign(void* dest, void* src) { *static_cast<T*>(dest) = std_move(*static_cast<T*>(src)); }
+		static bool equal(const void* a, const void* b) { return *static_cast<const T*>(a) == *static_cast<const T*>(b); }
+	};
+
+public:		/**** Ctors ****/
+	std_variant() : storage_(), index_() { std_construct_at(reinterpret_cast<type_at<0>*>(&storage_)); }
+	template<class T, class = typename std_enable_if<(index_of<T>::value < sizeof...(Ts))>::type>
+	std_variant(T&& value) : storage_(), index_() { construct<index_of<T>::value>(std_forward<T>(value)); }
+	template<size_t I, class... Args>
+	explicit std_variant(std_in_place_index_t<I>, Args&&... args) : storage_(), index_() { construct<I>(std_forward<Args>(args)...); }
+	template<class T, class... Args>
+	explicit std_variant(std_in_place_type_t<T>, Args&&... args) : storage_(), index_() { construct<index_of<T>::value>(std_forward<Args>(args)...); }
+	std_variant(const self_type&);
+	std_variant(self_type&&);
+	~std_variant() { destroy(); }
+
+	self_type& operator=(const self_type&);
+	self_type& operator=(self_type&&);
+	template<class T, class = typename std_enable_if<(index_of<T>::value < sizeof...(Ts))>::type>
+	self_type& operator=(T&&);
+
+public:		/**** Member Functions ****/
+	// Returns the index of the alternative currently held.
+	size_t					index() const { return index_; }
+	// Never true, since alternatives can't throw; provided for compatibility.
+	constexpr bool			valueless_by_exception() const { return false; }
+	// Destroys the current value and constructs the `I'th alternative from `args'.
+	template<size_t I, class... Args>
+	type_at<I>&				emplace(Args&&...);
+	// Destroys the current value and constructs a `T' from `args'.
+	template<class T, class... Args>
+	T&						emplace(Args&&... args) { return emplace<index_of<T>::value>(std_forward<Args>(args)...); }
+	void					swap(self_type&);
+	// Checks whether both variants hold the same alternative with equal values.
+	bool					equals(const self_type&) const;
+
+private:
+	// Constructs the `I'th alternative from `args' in storage that holds no live value.
+	template<size_t I, class... Args>
+	type_at<I>&				construct(Args&&...);
+	void					destroy();
+
+private:	/**** Member Objects ****/
+	storage_type	storage_;	// Storage for the current alternative.
+	index_type		index_;		// Index of the current alternative.
+};
+
+# pragma endregion
+
+#pragma region std_variant_ctors
+
+template<class... Ts>
+std_variant<Ts...>::std_variant(const self_type& other) :
+	storage_(), index_(other.index_)
+{
+	typedef void(*copy_type)(void*, const void*);
+	static const copy_type table[] = { &Ops<Ts>::copy... };
+
+	table[index_](&storage_, &other.storage_);
+}
+
+template<class... Ts>
+std_variant<Ts...>::std_variant(self_type&& other) :
+	storage_(), index_(other.index_)
+{
+	typedef void(*move_type)(void*, void*);
+	static const move_type table[] = { &Ops<Ts>::move... };
+
+	table[index_](&storage_, &other.storage_);
+}
+
+template<class... Ts>
+std_variant<Ts...>& std_variant<Ts...>::operator=(const self_type& other)
+{
+	typedef void(*copy_type)(void*, const void*);
+	static const copy_type assign_table[] = { &Ops<Ts>::copy_assign... };
+	static const copy_type copy_table[] = { &Ops<Ts>::copy... };
+
+	if (this == &other)
+		;
+	else if (index_ == other.index_)
+		assign_table[index_](&storage_, &other.storage_);
+	else
+	{
+		destroy();
+		copy_table[index_ = other.index_](&storage_, &other.storage_);
+	}
+
+	return *this;
+}
+
+template<class... Ts>
+std_variant<Ts...>& std_variant<Ts...>::operator=(self_type&& other)
+{
+	typedef void(*move_type)(void*, void*);
+	static const move_type assign_table[] = { &Ops<Ts>::move_assign... };
+	static const move_type move_table[] = { &Ops<Ts>::move... };
+
+	if (this == &other)
+		;
+	else if (index_ == other.index_)
+		assign_table[index_](&storage_, &other.storage_);
+	else
+	{
+		destroy();
+		move_table[index_ = other.index_](&storage_, &other.storage_);
+	}
+
+	return *this;
+}
+
+template<class... Ts>
+template<class T, class>
+std_variant<Ts...>& std_variant<Ts...>::operator=(T&& value)
+{
+	const size_t I = index_of<T>::value;
+
+	if (index_ == I)
+		std_variant_access::get<type_at<I>>(*this) = std_forward<T>(value);
+	else
+		emplace<I>(std_forward<T>(value));
+
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region std_variant_member_functions
+
+template<class... Ts>
+template<size_t I, class... Args>
+typename std_variant<Ts...>::template type_at<I>& std_variant<Ts...>::emplace(Args&&... args)
+{
+	destroy();
+
+	return construct<I>(std_forward<Args>(args)...);
+}
+
+template<class... Ts>
+void std_variant<Ts...>::swap(self_type& other)
+{
+	self_type tmp(std_move(other));
+
+	other = std_move(*this);
+	*this = std_move(tmp);
+}
+
+template<class... Ts>
+bool std_variant<Ts...>::equals(const self_type& other) const
+{
+	typedef bool(*equal_type)(const void*, const void*);
+	static const equal_type table[] = { &Ops<Ts>::equal... };
+
+	return index_ == other.index_ && table[index_](&storage_, &other.storage_);
+}
+
+template<class... Ts>
+template<size_t I, class... Args>
+typename std_variant<Ts...>::template type_at<I>& std_variant<Ts...>::construct(Args&&... args)
+{
+	static_assert(I < sizeof...(Ts), "std_variant alternative index out of range.");
+
+	index_ = I;
+
+	return *std_construct_at(reinterpret_cast<type_at<I>*>(&storage_), std_forward<Args>(args)...);
+}
+
+template<class... Ts>
+void std_variant<Ts...>::destroy()
+{
+	typedef void(*destroy_type)(void*);
+	static const destroy_type table[] = { &Ops<Ts>::destroy... };
+
+	table[index_](&storage_);
+}
+
+#pragma endregion
+
+#pragma region std_variant_non-member_functions
+
+template<class T, class... Ts>
+bool std_holds_alternative(const std_variant<Ts...>& v)
+{	// Returns true if `v' currently holds a `T'.
+	return v.index() == std_variant_index_of<T, Ts...>::value;
+}
+
+template<size_t I, class... Ts>
+typename std_variant_alternative<I, std_variant<Ts...>>::type& std_get(std_variant<Ts...>& v)
+{	// Returns a reference to the `I'th alternative of `v', which must be the one it holds.
+	assert(v.index() == I);
+	return std_variant_access::get<typename std_variant_alternative<I, std_variant<Ts...>>::type>(v);
+}
+
+template<size_t I, class... Ts>
+const typename std_variant_alternative<I, std_variant<Ts...>>::type& std_get(const std_variant<Ts...>& v)
+{	// Returns a const reference to the `I'th alternative of `v', which must be the one it holds.
+	assert(v.index() == I);
+	return std_variant_access::get<typename std_variant_alternative<I, std_variant<Ts...>>::type>(v);
+}
+
+template<class T, class... Ts>
+T& std_get(std_variant<Ts...>& v)
+{	// Returns a reference to the `T' held by `v', which must hold one.
+	static_assert(std_variant_index_of<T, Ts...>::value < sizeof...(Ts), "T is not an alternative of this std_variant.");
+	return std_get<std_variant_index_of<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+const T& std_get(const std_variant<Ts...>& v)
+{	// Returns a const reference to the `T' held by `v', which must hold one.
+	static_assert(std_variant_index_of<T, Ts...>::value < sizeof...(Ts), "T is not an alternative of this std_variant.");
+	return std_get<std_variant_index_of<T, Ts...>::value>(v);
+}
+
+template<size_t I, class... Ts>
+typename std_variant_alternative<I, std_variant<Ts...>>::type* std_get_if(std_variant<Ts...>* v)
+{	// Returns a pointer to the `I'th alternative of `v' if it holds that one, else a null pointer.
+	return v && v->index() == I ? &std_variant_access::get<typename std_variant_alternative<I, std_variant<Ts...>>::type>(*v) : nullptr;
+}
+
+template<size_t I, class... Ts>
+const typename std_variant_alternative<I, std_variant<Ts...>>::type* std_get_if(const std_variant<Ts...>* v)
+{	// Returns a const pointer to the `I'th alternative of `v' if it holds that one, else a null pointer.
+	return v && v->index() == I ? &std_variant_access::get<typename std_variant_alternative<I, std_variant<Ts...>>::type>(*v) : nullptr;
+}
+
+template<class T, class... Ts>
+T* std_get_if(std_variant<Ts...>* v)
+{	// Returns a pointer to the `T' held by `v' if it holds one, else a null pointer.
+	return std_get_if<std_variant_index_of<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+const T* std_get_if(const std_variant<Ts...>* v)
+{	// Returns a const pointer to the `T' held by `v' if it holds one, else a null pointer.
+	return std_get_if<std_variant_index_of<T, Ts...>::value>(v);
+}
+
+namespace
+{
+	// Calls `vis' with the `I'th alternative of `v'; one entry of the `std_visit()' jump table.
+	template<class R, size_t I, class Visitor, class V>
+	R std_visit_thunk(Visitor&& vis, V& v)
+	{
+		typedef typename std_variant_alternative<I, typename std_remove_cv<V>::type>::type alt_type;
+		typedef typename std_conditional<std_is_const<V>::value, const alt_type, alt_type>::type arg_type;
+
+		return std_forward<Visitor>(vis)(std_variant_access::get<arg_type>(v));
+	}
+
+	template<class R, class Visitor, class V, size_t... I>
+	R std_visit_impl(Visitor&& vis, V& v, std_index_sequence<I...>)
+	{
+		typedef R(*thunk_type)(Visitor&&, V&);
+		static const thunk_type table[] = { &std_visit_thunk<R, I, Visitor, V>... };
+
+		return table[v.index()](std_forward<Visitor>(vis), v);
+	}
+}
+
+template<class Visitor, class T, class... Ts>
+auto std_visit(Visitor&& vis, std_variant<T, Ts...>& v) -> decltype(std_declval<Visitor>()(std_declval<T&>()))
+{	// Calls `vis' with the alternative held by `v' and returns the result.
+	typedef decltype(std_declval<Visitor>()(std_declval<T&>())) result_type;
+
+	return std_visit_impl<result_type>(std_forward<Visitor>(vis), v, std_make_index_sequence<1 + sizeof...(Ts)>());
+}
+
+template<class Visitor, class T, class... Ts>
+auto std_visit(Visitor&& vis, const std_variant<T, Ts...>& v) -> decltype(std_declval<Visitor>()(std_declval<const T&>()))
+{	// Calls `vis' with the alternative held by `v' and returns the result.
+	typedef decltype(std_declval<Visitor>()(std_declval<const T&>())) result_type;
+
+	return std_visit_impl<result_type>(std_forward<Visitor>(vis), v, std_make_index_sequence<1 + sizeof...(Ts)>());
+}
+
+template<class... Ts>
+bool operator==(const std_variant<Ts...>& lhs, const std_variant<Ts...>& rhs)
+{	// Returns true if both hold the same alternative with equal values.
+	return lhs.equals(rhs);
+}
+
+template<class... Ts>
+bool operator!=(const std_variant<Ts...>& lhs, const std_variant<Ts...>& rhs)
+{	// Returns true if they hold different alternatives or unequal values.
+	return !lhs.equals(rhs);
+}
+
+inline constexpr bool operator==(std_monostate, std_monostate)
+{	// Returns true; all monostates are equal.
+	return true;
+}
+
+inline constexpr bool operator!=(std_monostate, std_monostate)
+{	// Returns false; all monostates are equal.
+	return false;
+}
+
+template<class... Ts>
+void swap(std_variant<Ts...>& lhs, std_variant<Ts...>& rhs)
+{	// Swaps the contents of two variants.
+	lhs.swap(rhs);
+}
+
+#pragma endregion
+
+#endif // !defined VARIANT_H__
@@ -18,9 +18,17 @@ void EEPROMStream::reset()
 EEPROMStream::address_type EEPROMStream::get(address_type address, String& value)
 {
 	// String objects must be read as individual chars, preceded by the count, 
-	// with an upper limit of 256 chars.
+	// with an upper limit of 256 chars. Append them to the `String' rather than 
+	// writing through `c_str()', which doesn't own enough memory.
+
+	uint8_t count = EEPROM.read(address);
 
-	return get(address, (char*)value.c_str());
+	value = "";
+	value.reserve(count);
+	for (uint8_t i = 0U; i < count; i++)
+		value += static_cast<char>(EEPROM.read(++address));
+
+	return count + 1U;
 }
 
 EEPROMStream::address_type EEPROMStream::get(address_type address, char* value)
@@ -43,7 +51,7 @@ EEPROMStream::address_type EEPROMStream::put(address_type address, const String&
 	// String objects must be written as individual chars, preceded by the count, 
 	// with an upper limit of 256 chars.
 
-	return put(address, value.c_str());
+	return put(address, std_string_view(value.c_str(), value.length()));
 }
 
 EEPROMStream::address_type EEPROMStream::put(address_type address, const char* value)
@@ -60,3 +68,33 @@ EEPROMStream::address_type EEPROMStream::put(address_type address, const char* v
 
 	return ++address - first;
 }
+
+EEPROMStream::address_type EEPROMStream::put(address_type address, std_string_view value)
+{
+	// The count is already known, so the chars needn't be measured.
+
+	assert(value.size() <= UINT8_MAX);
+	uint8_t count = value.size() <= UINT8_MAX ? value.size() : UINT8_MAX;
+	address_type first = address;
+
+	EEPROM.write(address, count);
+	for (uint8_t i = 0U; i < count; i++)
+		EEPROM.write(++address, value[i]);
+
+	return ++address - first;
+}
+
+EEPROMStream::address_type EEPROMStream::update(address_type address, std_string_view value)
+{
+	// Write only the bytes that differ, sparing EEPROM wear when the string is unchanged.
+
+	assert(value.size() <= UINT8_MAX);
+	uint8_t count = value.size() <= UINT8_MAX ? value.size() : UINT8_MAX;
+	address_type first = address;
+
+	EEPROM.update(address, count);
+	for (uint8_t i = 0U; i < count; i++)
+		EEPROM.update(++address, value[i]);
+
+	return ++address - first;
+}
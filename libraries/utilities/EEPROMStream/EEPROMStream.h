@@ -79,6 +79,16 @@
  *	write address internally. The `EEPROMStream::reset' method is provided to 
  *	initialize the address to a known state.
  * 
+ *	Collections of objects of different types that share a base type can be 
+ *	stored with a type identifier preceding each object, and reconstructed 
+ *	without the heap from a `TypeRegistry' (see <TypeRegistry.h>), which maps 
+ *	each identifier to a type and constructs it in an arena or buffer before 
+ *	it is deserialized:
+ * 
+ *		eeprom.store(MoveCommandId, move_cmd);	// Writes the id, then the object.
+ *		...
+ *		ISerialCommand* cmd = eeprom.load(registry, arena);
+ * 
  *	The stream insertion and extraction operators `EEPROMStream::operator<<' 
  *	and `::operator>>' work similarly to the C++ `std::iostream' operators except 
  *	that here, they read/write to and from the onboard EEPROM memory buffer 
@@ -88,6 +98,19 @@
  *	the EEPROM memory buffer, thus data is only written if it differs from the 
  *	currently stored data.
  *
+ *	Objects whose members are all trivially copyable or strings need neither 
+ *	`ISerializeable' nor hand-written chains of operators. A tuple of references 
+ *	to their members, returned by `std_tie()' (see <tuple.h>), lists the fields 
+ *	once, and each field is then read or written with its own overload. The 
+ *	calls are resolved at compile time and inline to the same code as the 
+ *	operator chains:
+ * 
+ *		struct config_t { uint8_t id; int16_t offset; std_fixed_string<8> name; };
+ * 
+ *		eeprom << std_tie(config.id, config.offset, config.name);
+ *		...
+ *		eeprom >> std_tie(config.id, config.offset, config.name);
+ *
  *	***************************************************************************
  * 
  *	The `SerializableList' class template encapsulates a collection of objects 
@@ -140,7 +163,11 @@
 # include "library.h"			// Arduino API
 # include "EEPROM.h"			// Arduino EEPROM api.
 # include "array.h"				// `ArrayWrapper' type, `std_begin()' & `std_end()'.
+# include "string_view.h"		// `std_string_view' type.
+# include "fixed_string.h"		// `std_fixed_string' type.
+# include "tuple.h"				// `std_tuple' type, `std_tuple_for_each()'.
 # include "ISerializeable.h"	// `ISerializeable' interface.
+# include "TypeRegistry.h"		// `TypeRegistry' type.
 
 // Type that serializes objects to and from the onboard EEPROM.
 class EEPROMStream
@@ -159,6 +186,9 @@ public:
 	// EEPROM stream extraction operator.
 	template<class T>
 	EEPROMStream& operator>>(T&);
+	// EEPROM stream extraction operator for a tuple of references, such as one returned by `std_tie()'.
+	template<class... Ts>
+	EEPROMStream& operator>>(std_tuple<Ts...>&&);
 	// Returns a mutable reference to the current read/write address.
 	address_type& address();
 	// Returns a immutable reference to the current read/write address.
@@ -177,6 +207,16 @@ public:
 	// Deserializes an object of type `T' from the EEPROM.
 	template<class T>
 	void load(T& t);
+	// Reads a type identifier, then constructs an object of that type in an arena and 
+	// deserializes it from the EEPROM. Returns a null pointer if the type is unknown or 
+	// the arena is exhausted.
+	template<class Base>
+	Base* load(const TypeRegistry<Base>&, std_arena&);
+	// Reads a type identifier, then constructs an object of that type in a buffer and 
+	// deserializes it from the EEPROM. Returns a null pointer if the type is unknown or 
+	// the buffer is too small.
+	template<class Base>
+	Base* load(const TypeRegistry<Base>&, void*, size_t);
 	// Serializes a collection of objects of type `T' to the EEPROM.
 	template<class T, size_type N>
 	void store(const T(&t)[N]);
@@ -189,6 +229,9 @@ public:
 	// Serializes an object of type `T' to the EEPROM.
 	template<class T>
 	void store(const T& t);
+	// Serializes a type identifier followed by an object of type `T' to the EEPROM.
+	template<class T>
+	void store(uint8_t id, const T& t);
 
 public:
 	// Reads the value of an object of type `T' from the EEPROM at the given address. 
@@ -198,6 +241,13 @@ public:
 	static address_type	get(address_type, String&);
 	// Reads the value of a c-string object from the EEPROM at the given address. 
 	static address_type	get(address_type, char*);
+	// Reads the value of a fixed-capacity string from the EEPROM at the given address, 
+	// truncating it to the string's capacity. 
+	template<size_t N>
+	static address_type	get(address_type, std_fixed_string<N>&);
+	// Reads the values of the elements of a tuple from the EEPROM at the given address, in order. 
+	template<class... Ts>
+	static address_type	get(address_type, std_tuple<Ts...>&);
 	// Writes the value of an object of type `T' to the EEPROM at the given address. 
 	template<class T>
 	static address_type	put(address_type, const T&);
@@ -205,10 +255,34 @@ public:
 	static address_type	put(address_type, const String&);
 	// Writes the value of a c-string object to the EEPROM at the given address. 
 	static address_type	put(address_type, const char*);
+	// Writes the chars referred to by a string view to the EEPROM at the given address. 
+	static address_type	put(address_type, std_string_view);
+	// Writes the value of a fixed-capacity string to the EEPROM at the given address. 
+	template<size_t N>
+	static address_type	put(address_type, const std_fixed_string<N>&);
+	// Writes the values of the elements of a tuple to the EEPROM at the given address, in order. 
+	template<class... Ts>
+	static address_type	put(address_type, const std_tuple<Ts...>&);
 	// Writes the value of an object of type `T' to the EEPROM at the given address 
 	// if it differs from the currently stored value at that address.
 	template<class T>
 	static address_type	update(address_type, const T&);
+	// Writes the chars referred to by a string view to the EEPROM at the given address, 
+	// skipping any bytes that are already stored.
+	static address_type	update(address_type, std_string_view);
+	// Writes the value of a fixed-capacity string to the EEPROM at the given address, 
+	// skipping any bytes that are already stored.
+	template<size_t N>
+	static address_type	update(address_type, const std_fixed_string<N>&);
+	// Updates the values of the elements of a tuple in the EEPROM at the given address, in order. 
+	template<class... Ts>
+	static address_type	update(address_type, const std_tuple<Ts...>&);
+
+private:
+	// Function objects that read, write or update one tuple element and advance an address.
+	struct ElementGetter { address_type& address; template<class T> void operator()(T& t) const { address += get(address, t); } };
+	struct ElementPutter { address_type& address; template<class T> void operator()(const T& t) const { address += put(address, t); } };
+	struct ElementUpdater { address_type& address; template<class T> void operator()(const T& t) const { address += update(address, t); } };
 
 private:
 	address_type address_;	// The current EEPROM read/write address.
@@ -231,6 +305,14 @@ EEPROMStream& EEPROMStream::operator>>(T& t)
 	return *this;
 }
 
+template<class... Ts>
+EEPROMStream& EEPROMStream::operator>>(std_tuple<Ts...>&& t)
+{
+	address_ += get(address_, t);
+
+	return *this;
+}
+
 template<class T, EEPROMStream::size_type N>
 void EEPROMStream::load(T(&t)[N])
 {
@@ -260,6 +342,32 @@ void EEPROMStream::load(T& t)
 	static_cast<ISerializeable*>(p)->deserialize(*this);
 }
 
+template<class Base>
+Base* EEPROMStream::load(const TypeRegistry<Base>& registry, std_arena& arena)
+{
+	typename TypeRegistry<Base>::id_type id;
+
+	*this >> id;
+	Base* p = registry.create(id, arena);
+	if (p)
+		load(*p);
+
+	return p;
+}
+
+template<class Base>
+Base* EEPROMStream::load(const TypeRegistry<Base>& registry, void* buf, size_t size)
+{
+	typename TypeRegistry<Base>::id_type id;
+
+	*this >> id;
+	Base* p = registry.create(id, buf, size);
+	if (p)
+		load(*p);
+
+	return p;
+}
+
 template<class T, EEPROMStream::size_type N>
 void EEPROMStream::store(const T(&t)[N])
 {
@@ -289,6 +397,13 @@ void EEPROMStream::store(const T& t)
 	static_cast<const ISerializeable*>(p)->serialize(*this);
 }
 
+template<class T>
+void EEPROMStream::store(uint8_t id, const T& t)
+{
+	*this << id;
+	store(t);
+}
+
 template<class T>
 EEPROMStream::address_type EEPROMStream::get(address_type address, T& value)
 {
@@ -316,6 +431,63 @@ EEPROMStream::address_type EEPROMStream::update(address_type address, const T& v
 
 	return n;	// Return the number of bytes read, or written if the update occured.
 }
+
+template<size_t N>
+EEPROMStream::address_type EEPROMStream::get(address_type address, std_fixed_string<N>& value)
+{
+	// Strings are stored as individual chars, preceded by the count. Any chars 
+	// beyond the string's capacity are skipped.
+
+	uint8_t count = EEPROM.read(address);
+
+	value.clear();
+	for (uint8_t i = 0U; i < count; i++)
+		value.push_back(static_cast<char>(EEPROM.read(address + 1U + i)));
+
+	return count + 1U;
+}
+
+template<size_t N>
+EEPROMStream::address_type EEPROMStream::put(address_type address, const std_fixed_string<N>& value)
+{
+	return put(address, std_string_view(value));
+}
+
+template<size_t N>
+EEPROMStream::address_type EEPROMStream::update(address_type address, const std_fixed_string<N>& value)
+{
+	return update(address, std_string_view(value));
+}
+
+template<class... Ts>
+EEPROMStream::address_type EEPROMStream::get(address_type address, std_tuple<Ts...>& value)
+{
+	const address_type first = address;
+
+	std_tuple_for_each(value, ElementGetter{ address });
+
+	return address - first;
+}
+
+template<class... Ts>
+EEPROMStream::address_type EEPROMStream::put(address_type address, const std_tuple<Ts...>& value)
+{
+	const address_type first = address;
+
+	std_tuple_for_each(value, ElementPutter{ address });
+
+	return address - first;
+}
+
+template<class... Ts>
+EEPROMStream::address_type EEPROMStream::update(address_type address, const std_tuple<Ts...>& value)
+{
+	const address_type first = address;
+
+	std_tuple_for_each(value, ElementUpdater{ address });
+
+	return address - first;
+}
 #pragma endregion
 
 #endif // !defined EEPROMSTREAM_H__ 
\ No newline at end of file
@@ -0,0 +1,177 @@
+/*
+ *	This file defines a registry of types that can be constructed from a
+ *	serialized type identifier.
+ *
+ *	***************************************************************************
+ *
+ *	File: TypeRegistry.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *	The `TypeRegistry' class template maps client-defined type identifiers
+ *	to concrete types derived from a common base type `Base', and constructs
+ *	objects of those types on demand in client-supplied storage, without
+ *	using the heap. Its main use is reconstructing a heterogeneous collection
+ *	of objects, such as `ISerialCommand' objects, from serialized data in
+ *	which each object's state is preceded by its type identifier (see
+ *	`EEPROMStream::load()').
+ *
+ *	The registry is built from a constant table of `Entry' records, one per
+ *	type, which `entry<T>()' creates at compile time. Each record holds the
+ *	type's identifier, size and alignment, and a function that default
+ *	constructs the type at a given address. Objects can be constructed in a
+ *	raw buffer, such as a block from an object pool sized for the largest
+ *	registered type, or allocated from an arena (see <arena.h>):
+ *
+ *		using Registry = TypeRegistry<ISerialCommand>;
+ *
+ *		const Registry::Entry command_types[] =
+ *		{
+ *			Registry::entry<MoveCommand>(1),
+ *			Registry::entry<WaitCommand>(2)
+ *		};
+ *		const Registry registry(command_types);
+ *
+ *		ISerialCommand* cmd = registry.create(1, arena); // Constructs a `MoveCommand'.
+ *
+ *	Registered types must be default constructible. Objects constructed by
+ *	the registry must be destroyed by the client, by calling their
+ *	destructor, before their storage is reused.
+ *
+ *	***************************************************************************/
+
+#if !defined TYPEREGISTRY_H__
+# define TYPEREGISTRY_H__ 20261018L
+
+# include <stdint.h>			// `uint8_t', `uintptr_t' types.
+# include "arena.h"				// `std_arena' type.
+# include "uninitialized.h"		// `std_construct_at()'.
+
+// Registry of types derived from `Base' keyed by a serialized type identifier.
+template <class Base>
+class TypeRegistry
+{
+public:
+	using id_type = uint8_t;	// Serialized type identifier type.
+
+	// Registered type record.
+	struct Entry
+	{
+		id_type	id;					// The type's identifier.
+		size_t	size;				// sizeof the type.
+		size_t	align;				// alignof the type.
+		Base*	(*construct)(void*);// Default constructs the type at an address.
+	};
+
+public:
+	template <size_t Size>
+	explicit TypeRegistry(const Entry (&)[Size]);
+	TypeRegistry(const Entry*, const Entry*);
+
+public:
+	// Returns the registry record of type `T' with identifier `id'.
+	template <class T>
+	static constexpr Entry entry(id_type id) { return Entry{ id, sizeof(T), alignof(T), &construct<T> }; }
+	// Returns the record with identifier `id', or a null pointer if none.
+	const Entry*	find(id_type) const;
+	// Constructs the type with identifier `id' in a buffer, returns a null pointer if the type is
+	// unknown or the buffer is too small or misaligned.
+	Base*			create(id_type, void*, size_t) const;
+	// Constructs the type with identifier `id' in storage allocated from an arena, returns a null
+	// pointer if the type is unknown or the arena is exhausted.
+	Base*			create(id_type, std_arena&) const;
+	// Returns the size of the largest registered type.
+	size_t			max_size() const;
+
+private:
+	template <class T>
+	static Base* construct(void* p) { return std_construct_at(static_cast<T*>(p)); }
+
+private:
+	const Entry*	first_;	// First record in the registry table.
+	const Entry*	last_;	// One past the last record.
+};
+
+template <class Base>
+template <size_t Size>
+TypeRegistry<Base>::TypeRegistry(const Entry (&entries)[Size]) :
+	TypeRegistry(entries, entries + Size)
+{
+
+}
+
+template <class Base>
+TypeRegistry<Base>::TypeRegistry(const Entry* first, const Entry* last) :
+	first_(first), last_(last)
+{
+
+}
+
+template <class Base>
+const typename TypeRegistry<Base>::Entry* TypeRegistry<Base>::find(id_type id) const
+{
+	for (const Entry* it = first_; it != last_; ++it)
+	{
+		if (it->id == id)
+			return it;
+	}
+
+	return nullptr;
+}
+
+template <class Base>
+Base* TypeRegistry<Base>::create(id_type id, void* buf, size_t size) const
+{
+	const Entry* e = find(id);
+
+	return e && buf && size >= e->size && reinterpret_cast<uintptr_t>(buf) % e->align == 0
+		? (*e->construct)(buf)
+		: nullptr;
+}
+
+template <class Base>
+Base* TypeRegistry<Base>::create(id_type id, std_arena& arena) const
+{
+	const Entry* e = find(id);
+	void* p = e ? arena.allocate(e->size, e->align) : nullptr;
+
+	return p ? (*e->construct)(p) : nullptr;
+}
+
+template <class Base>
+size_t TypeRegistry<Base>::max_size() const
+{
+	size_t n = 0;
+
+	for (const Entry* it = first_; it != last_; ++it)
+	{
+		if (it->size > n)
+			n = it->size;
+	}
+
+	return n;
+}
+
+#endif // !defined TYPEREGISTRY_H__
@@ -0,0 +1,325 @@
+/*
+ *	This file defines a publish/subscribe event bus type that implements the
+ *	`IMediator' interface.
+ *
+ *	***************************************************************************
+ *
+ *	File: EventBus.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	**************************************************************************
+ *
+ *	Description:
+ *
+ *	The `EventBus' class is a concrete mediator (see <IMediator.h>) that
+ *	decouples components which publish notifications from the handlers that
+ *	act on them. Each notification belongs to a topic, which is a value of
+ *	a client-defined enumeration returned by the notification's `topic()'
+ *	method. Handlers subscribe to topics through a constant table of
+ *	`Subscriber' records that is built at compile time, so subscribing costs
+ *	no RAM for bookkeeping and no registration calls at run time.
+ *
+ *	Publishing, either with `publish()' or through the `IMediator::notify()'
+ *	interface, copies the notification into a bounded FIFO queue and returns
+ *	immediately. It never blocks: if the queue is full the notification is
+ *	dropped and counted, and `publish()' returns `false'. On AVR targets
+ *	publishing is safe from interrupt service routines, since publishers
+ *	are serialized by disabling interrupts. Other cores have no portable
+ *	way to save and restore the interrupt state, so there notifications
+ *	must only be published from the main loop. Handlers are only ever called from
+ *	`clock()', which drains the queue and fans each notification out to every
+ *	subscriber of its topic, in table order. `clock()' is meant to be run by
+ *	a `TaskScheduler' task through a `ClockCommand' (see <IClockable.h>), so
+ *	fan-out happens in the main loop, outside interrupt and time-critical
+ *	code. Notifications published by handlers are delivered on the next
+ *	call to `clock()'.
+ *
+ *	The bus keeps delivery statistics: the current and largest number of
+ *	queued notifications, the number delivered and dropped, and the largest
+ *	and mean delivery latency, measured in microseconds from `publish()' to
+ *	the start of fan-out.
+ *
+ *	The client-defined `Notification' class must be default constructible,
+ *	copy assignable and provide a `Topic topic() const' method, and it must
+ *	be defined before this file is included, since the bus stores copies of
+ *	it. The queue capacity `QueueSize' must be a power of two.
+ *
+ *	Examples:
+ *
+ *		enum class Topic : uint8_t { Key, Actuator };
+ *
+ *		class Notification
+ *		{
+ *		public:
+ *			Topic topic() const { return topic_; }
+ *			...
+ *		};
+ *
+ *		using Bus = EventBus<Topic, 8>;
+ *
+ *		void onKey(IComponent*, const Notification&);
+ *		void onActuator(IComponent*, const Notification&);
+ *
+ *		const Bus::Subscriber subscribers[] =
+ *		{
+ *			{ Topic::Key, &onKey },
+ *			{ Topic::Actuator, &onActuator }
+ *		};
+ *
+ *		Bus bus(subscribers);
+ *		ClockCommand bus_cmd(bus);
+ *		TaskScheduler::Task bus_task(&bus_cmd, 0, TaskScheduler::Task::State::Active);
+ *
+ *		...
+ *
+ *		mediator_->notify(this, Notification(Topic::Key, ...));
+ *
+ *****************************************************************************/
+
+#if !defined EVENTBUS_H__
+# define EVENTBUS_H__ 20261018L
+
+# include "library.h"			// Arduino API.
+# include "types.h"				// `Arduino' and `stdint' types.
+# include "ring_buffer.h"		// `std_spsc_ring_buffer'.
+# include "IClockable.h"		// `IClockable' interface.
+# include "IComponent.h"		// `IComponent' and `IMediator' interfaces.
+
+// Publish/subscribe mediator with queued delivery.
+template <class Topic, size_t QueueSize>
+class EventBus : public IMediator, public IClockable
+{
+public:
+	// Notification handler type.
+	using handler_type = void(*)(IComponent* sender, const Notification& notification);
+
+	// Subscription record type, binds a handler to a topic.
+	struct Subscriber
+	{
+		Topic			topic;		// Subscribed topic.
+		handler_type	handler;	// Handler called with each notification of `topic'.
+	};
+
+	using size_type = size_t;
+
+private:
+	// Queued notification type.
+	struct Event
+	{
+		IComponent*		sender;			// The publishing component.
+		Notification	notification;	// A copy of the published notification.
+		usecs_t			posted;			// The time the notification was published.
+	};
+
+	using queue_type = std_spsc_ring_buffer<Event, QueueSize>;
+
+public:
+	template <size_t Size>
+	explicit EventBus(const Subscriber (&)[Size]);
+	EventBus(const Subscriber*, const Subscriber*);
+	EventBus(const EventBus&) = delete;
+	EventBus& operator=(const EventBus&) = delete;
+
+public:
+	// Queues a notification for delivery, returns `false' if the queue is full.
+	bool		publish(IComponent*, const Notification&);
+	// Queues a notification for delivery, dropping it if the queue is full.
+	void		notify(IComponent*, const Notification&) const override;
+	// Delivers all notifications queued before the call to their subscribers.
+	void		clock() override;
+	// Returns the number of queued notifications.
+	size_type	depth() const;
+	// Returns the largest number of notifications ever queued at once.
+	size_type	high_water() const;
+	// Returns the number of notifications delivered.
+	uint32_t	delivered() const;
+	// Returns the number of notifications dropped because the queue was full.
+	uint32_t	dropped() const;
+	// Returns the largest delivery latency, in microseconds.
+	usecs_t		max_latency() const;
+	// Returns the mean delivery latency, in microseconds.
+	usecs_t		mean_latency() const;
+	// Clears all statistics except the current depth.
+	void		reset_stats();
+
+private:
+	// Queues a notification, returns `false' and counts it as dropped if the queue is full.
+	bool		post(IComponent*, const Notification&) const;
+
+private:
+	const Subscriber*	first_;			// First subscriber in the subscriber table.
+	const Subscriber*	last_;			// One past the last subscriber.
+	// `notify()' is const in `IMediator', but queuing changes the bus's state.
+	mutable queue_type	queue_;			// Notifications awaiting delivery.
+	mutable size_type	high_water_;	// Largest queue depth.
+	mutable uint32_t	dropped_;		// Number of dropped notifications.
+	uint32_t			delivered_;		// Number of delivered notifications.
+	usecs_t				max_latency_;	// Largest delivery latency.
+	uint64_t			total_latency_;	// Sum of all delivery latencies, for the mean, 64 bits so it doesn't wrap.
+};
+
+template <class Topic, size_t QueueSize>
+template <size_t Size>
+EventBus<Topic, QueueSize>::EventBus(const Subscriber (&subscribers)[Size]) :
+	EventBus(subscribers, subscribers + Size)
+{
+
+}
+
+template <class Topic, size_t QueueSize>
+EventBus<Topic, QueueSize>::EventBus(const Subscriber* first, const Subscriber* last) :
+	first_(first), last_(last), queue_(), high_water_(), dropped_(), delivered_(),
+	max_latency_(), total_latency_()
+{
+
+}
+
+template <class Topic, size_t QueueSize>
+bool EventBus<Topic, QueueSize>::publish(IComponent* sender, const Notification& notification)
+{
+	return post(sender, notification);
+}
+
+template <class Topic, size_t QueueSize>
+void EventBus<Topic, QueueSize>::notify(IComponent* sender, const Notification& notification) const
+{
+	(void)post(sender, notification);
+}
+
+template <class Topic, size_t QueueSize>
+void EventBus<Topic, QueueSize>::clock()
+{
+	// Only drain what's queued now, so handlers that publish can't starve the caller.
+	Event event;
+
+	for (size_type n = queue_.size(); n != 0 && queue_.pop(event); --n)
+	{
+		const usecs_t latency = micros() - event.posted;
+		const Topic topic = event.notification.topic();
+
+		++delivered_;
+		total_latency_ += latency;
+		if (latency > max_latency_)
+			max_latency_ = latency;
+		for (const Subscriber* it = first_; it != last_; ++it)
+		{
+			if (it->topic == topic)
+				(*it->handler)(event.sender, event.notification);
+		}
+	}
+}
+
+template <class Topic, size_t QueueSize>
+typename EventBus<Topic, QueueSize>::size_type EventBus<Topic, QueueSize>::depth() const
+{
+	return queue_.size();
+}
+
+template <class Topic, size_t QueueSize>
+typename EventBus<Topic, QueueSize>::size_type EventBus<Topic, QueueSize>::high_water() const
+{
+	size_type n;
+
+	// Written by publishers, which may be ISRs.
+# if defined __AVR__
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+# endif
+	{
+		n = high_water_;
+	}
+
+	return n;
+}
+
+template <class Topic, size_t QueueSize>
+uint32_t EventBus<Topic, QueueSize>::delivered() const
+{
+	return delivered_;
+}
+
+template <class Topic, size_t QueueSize>
+uint32_t EventBus<Topic, QueueSize>::dropped() const
+{
+	uint32_t n;
+
+	// Written by publishers, which may be ISRs.
+# if defined __AVR__
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+# endif
+	{
+		n = dropped_;
+	}
+
+	return n;
+}
+
+template <class Topic, size_t QueueSize>
+usecs_t EventBus<Topic, QueueSize>::max_latency() const
+{
+	return max_latency_;
+}
+
+template <class Topic, size_t QueueSize>
+usecs_t EventBus<Topic, QueueSize>::mean_latency() const
+{
+	return delivered_ ? static_cast<usecs_t>(total_latency_ / delivered_) : 0;
+}
+
+template <class Topic, size_t QueueSize>
+void EventBus<Topic, QueueSize>::reset_stats()
+{
+	// Written by publishers, which may be ISRs.
+# if defined __AVR__
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+# endif
+	{
+		high_water_ = queue_.size();
+		dropped_ = 0;
+	}
+	delivered_ = 0;
+	max_latency_ = 0;
+	total_latency_ = 0;
+}
+
+template <class Topic, size_t QueueSize>
+bool EventBus<Topic, QueueSize>::post(IComponent* sender, const Notification& notification) const
+{
+	const Event event = { sender, notification, micros() };
+	bool queued;
+
+	// The queue has one consumer, `clock()', but may have several producers,
+	// including ISRs, so publishers are serialized for the few cycles a push takes.
+# if defined __AVR__
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+# endif
+	{
+		queued = queue_.push(event);
+		if (!queued)
+			++dropped_;
+		else if (queue_.size() > high_water_)
+			high_water_ = queue_.size();
+	}
+
+	return queued;
+}
+
+#endif // !defined EVENTBUS_H__
@@ -25,7 +25,10 @@ void TaskScheduler::tick()
 		if (scheduled(task))
 		{
 			(*task)->last_ = millis();
-			(*task)->command_->execute();
+			if ((*task)->command_)
+				(*task)->command_->execute();
+			else
+				(*task)->delegate_();
 		}
 	}
 }
@@ -37,11 +40,17 @@ bool TaskScheduler::scheduled(const_iterator task) const
 #pragma endregion
 #pragma region Task
 TaskScheduler::Task::Task(ICommand* command, msecs_t interval, State state) :
-	command_(command), interval_(interval), last_(), state_(state)
+	command_(command), delegate_(), interval_(interval), last_(), state_(state)
 {
 	assert(command);
 }
 
+TaskScheduler::Task::Task(delegate_type delegate, msecs_t interval, State state) :
+	command_(), delegate_(delegate), interval_(interval), last_(), state_(state)
+{
+	assert(delegate);
+}
+
 ICommand* TaskScheduler::Task::command() 
 { 
 	return command_; 
@@ -52,6 +61,11 @@ const ICommand* TaskScheduler::Task::command() const
 	return command_; 
 }
 
+const TaskScheduler::Task::delegate_type& TaskScheduler::Task::delegate() const
+{
+	return delegate_;
+}
+
 msecs_t& TaskScheduler::Task::interval() 
 { 
 	return interval_; 
@@ -74,6 +88,6 @@ const TaskScheduler::Task::State& TaskScheduler::Task::state() const
 
 bool TaskScheduler::Task::operator==(const Task& other) const 
 {
-	return this->command_ == other.command_;
+	return this->command_ == other.command_ && this->delegate_ == other.delegate_;
 }
 #pragma endregion
\ No newline at end of file
@@ -34,6 +34,7 @@
 # include "types.h"			// `Arduino' and `stdint' types.
 # include "array.h"			// STL fixed-size array types.
 # include "IClockable.h"	// `IClockable' interface.
+# include "Delegate.h"		// `Delegate' type.
 
 // Asynchronous task scheduling type.
 class TaskScheduler
@@ -44,6 +45,10 @@ public:
 	{
 		friend class TaskScheduler; // Taskscheduler needs access to private members.
 
+	public:
+		// Task delegate type.
+		using delegate_type = Delegate<void()>;
+
 	public:
 		// Task state type.
 		enum class State
@@ -57,6 +62,8 @@ public:
 		Task() = default;
 		// Task constructor.
 		Task(ICommand*, msecs_t, State);
+		// Task delegate constructor.
+		Task(delegate_type, msecs_t, State);
 		// No copy constructor.
 		Task(const Task&) = delete;
 		// No copy assignment operator.
@@ -67,6 +74,8 @@ public:
 		ICommand*		command();
 		// Returns an immutable iterator to the task command object.
 		const ICommand* command() const;
+		// Returns the task delegate, which is empty if the task has a command object.
+		const delegate_type& delegate() const;
 		// Returns a mutable reference to the task interval. 
 		msecs_t&		interval();
 		// Returns an immutable reference to the task interval. 
@@ -79,10 +88,11 @@ public:
 		bool			operator==(const Task&) const;
 
 	private:
-		ICommand*	command_;	// The current command object.
-		msecs_t		interval_;	// The current scheduling interval.
-		msecs_t		last_;		// The last time this task was scheduled.
-		State		state_;		// The current task state.
+		ICommand*		command_;	// The current command object, if any.
+		delegate_type	delegate_;	// The current delegate, if no command object.
+		msecs_t			interval_;	// The current scheduling interval.
+		msecs_t			last_;		// The last time this task was scheduled.
+		State			state_;		// The current task state.
 	};
 
 	using container_type = ArrayWrapper<Task*>;
@@ -1,19 +1,24 @@
 #include "Unique.h"
 
-Unique::uniq_t Unique::next_ = 0;	// Initialize the unique identifier to zero.
+uint8_t Unique::used_[];	// Zero initialized, all identifiers are free.
 
 Unique::Unique() : 
-	id_(next_++) 
+	id_(acquire()) 
 {
 
 }
 
 Unique::Unique(const Unique& other) : 
-	id_(next_++) 
+	id_(acquire()) 
 {
 
 }
 
+Unique::~Unique()
+{
+	release(id_);
+}
+
 Unique& Unique::operator=(const Unique& other) 
 { 
 	// `id_' member isn't copied, derived types retain their original unique id.
@@ -23,4 +28,31 @@ Unique& Unique::operator=(const Unique& other)
 Unique::uniq_t Unique::id() const
 { 
 	return id_; 
-};
\ No newline at end of file
+};
+
+Unique::uniq_t Unique::acquire()
+{
+	// Skip full bytes, then take the lowest clear bit of the first byte with one.
+	for (uint8_t i = 0; i < sizeof(used_); ++i)
+	{
+		if (used_[i] != UINT8_MAX)
+		{
+			const uint8_t bit = __builtin_ctz(static_cast<uint8_t>(~used_[i]));
+			const uniq_t id = i * CHAR_BIT + bit;
+
+			if (id == InvalidId)
+				break;
+			used_[i] |= 1U << bit;
+
+			return id;
+		}
+	}
+
+	return InvalidId;
+}
+
+void Unique::release(uniq_t id)
+{
+	if (id != InvalidId)
+		used_[id / CHAR_BIT] &= ~(1U << id % CHAR_BIT);
+}
\ No newline at end of file
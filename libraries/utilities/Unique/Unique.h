@@ -31,17 +31,26 @@
 # define UNIQUE_H 20210407L
 
 #include <stdint.h>	// `uint8_t' type.
+#include <limits.h>	// `CHAR_BIT'.
 
 // Base class for all types having a unique identifier.
+//
+// Identifiers are recycled: each new instance is assigned the lowest identifier not held
+// by a live instance and releases it when destroyed, so at most `UINT8_MAX' instances may
+// exist at once, no matter how many have been created and destroyed. Instances created
+// while all identifiers are held are assigned `InvalidId'.
 class Unique
 {
 public:
 	using uniq_t = uint8_t;	// uniq_t type alias, max of UINT8_MAX unique objects.
 
+	static const uniq_t InvalidId = UINT8_MAX;	// Identifier of instances created when none are free.
+
 protected: 
 	Unique();				// Not directly constructable, copyable or assignable.			
 	explicit Unique(const Unique& other);
 	Unique& operator=(const Unique& other);
+	~Unique();				// Releases the instance's unique identifier.
 
 public:		
 	uniq_t id() const;		// Returns the instance's unique identifier.
@@ -50,7 +59,11 @@ protected:
 	uniq_t id_;				// This instance's unique identifier.
 
 private:
-	static uniq_t next_;	// Holds the next unique identifier to be assigned.
+	static uniq_t acquire();		// Assigns and returns the lowest free identifier.
+	static void release(uniq_t);	// Frees an identifier for reuse.
+
+private:
+	static uint8_t used_[(InvalidId + CHAR_BIT) / CHAR_BIT];	// Bitmap of the identifiers in use.
 };
 
 #endif
@@ -0,0 +1,174 @@
+/*
+ *	This file defines a registry of objects indexed by their unique identifier.
+ *
+ *	***************************************************************************
+ *
+ *	File: UniqueRegistry.h
+ *	Date: October 18, 2026
+ *	Version: 0.99
+ *	Author: Michael Brodsky
+ *	Email: mbrodskiis@gmail.com
+ *	Copyright (c) 2012-2026 Michael Brodsky
+ *
+ *	***************************************************************************
+ *
+ *  This file is part of "Pretty Good" (Pg). "Pg" is free software:
+ *	you can redistribute it and/or modify it under the terms of the
+ *	GNU General Public License as published by the Free Software Foundation,
+ *	either version 3 of the License, or (at your option) any later version.
+ *
+ *  This file is distributed in the hope that it will be useful, but
+ *	WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *	along with this file. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *	***************************************************************************
+ *
+ *	Description:
+ *
+ *	The `UniqueRegistry' class template maps unique identifiers (see
+ *	<Unique.h>) back to the objects that hold them. Objects derived from both
+ *	`Unique' and a common base type `Base', usually `IComponent', register
+ *	themselves with a client-defined type tag, and can then be looked up by
+ *	identifier with a single array index, for instance to address any
+ *	component from a `SerialRemote' command or an `EventBus' notification
+ *	that carries its identifier. Lookups can also check the object's tag,
+ *	which guards against addressing an object of the wrong type.
+ *
+ *	The registry is a fixed table of `Size' entries indexed by identifier.
+ *	Since `Unique' always assigns the lowest free identifier, `Size' need
+ *	only be as large as the number of `Unique' objects alive at any one
+ *	time. Objects whose identifier does not fit are not registered.
+ *
+ *	Objects must remove themselves from the registry before they are
+ *	destroyed, because their identifier is reused by the next `Unique'
+ *	object created.
+ *
+ *	Examples:
+ *
+ *		enum class ComponentTag : uint8_t { Actuator, Display };
+ *
+ *		using Registry = UniqueRegistry<IComponent, ComponentTag, 8>;
+ *		Registry registry;
+ *
+ *		class Actuator : public IComponent, public Unique
+ *		{
+ *		public:
+ *			Actuator() { registry.add(this, ComponentTag::Actuator); }
+ *			~Actuator() { registry.remove(id()); }
+ *			...
+ *		};
+ *
+ *		IComponent* c = registry.find(id, ComponentTag::Actuator);
+ *
+ *	**************************************************************************/
+
+#if !defined UNIQUEREGISTRY_H__
+# define UNIQUEREGISTRY_H__ 20261018L
+
+# include <stddef.h>			// `size_t' type.
+# include "Unique.h"			// `Unique' base class.
+
+// Table of objects derived from `Base' and `Unique', indexed by unique identifier.
+template <class Base, class Tag, size_t Size>
+class UniqueRegistry
+{
+public:
+	using uniq_t = Unique::uniq_t;
+	using size_type = size_t;
+
+	// Registered object record.
+	struct Entry
+	{
+		Base*	object;	// The registered object, or a null pointer if none.
+		Tag		tag;	// The object's type tag.
+	};
+
+public:
+	UniqueRegistry();
+	UniqueRegistry(const UniqueRegistry&) = delete;
+	UniqueRegistry& operator=(const UniqueRegistry&) = delete;
+
+public:
+	// Registers an object with a type tag, returns `false' if its identifier is taken or out of range.
+	template <class T>
+	bool			add(T*, Tag);
+	// Removes the object with identifier `id', returns `false' if none.
+	bool			remove(uniq_t);
+	// Returns the object with identifier `id', or a null pointer if none.
+	Base*			find(uniq_t) const;
+	// Returns the object with identifier `id' and type tag `tag', or a null pointer if none.
+	Base*			find(uniq_t, Tag) const;
+	// Returns the record of identifier `id', or a null pointer if it is out of range.
+	const Entry*	entry(uniq_t) const;
+	// Returns the number of registered objects.
+	size_type		size() const;
+	// Returns the number of objects the registry can hold.
+	static constexpr size_type capacity() { return Size; }
+
+private:
+	Entry		entries_[Size];	// Registered objects indexed by identifier.
+	size_type	size_;			// Number of registered objects.
+};
+
+template <class Base, class Tag, size_t Size>
+UniqueRegistry<Base, Tag, Size>::UniqueRegistry() :
+	entries_(), size_()
+{
+
+}
+
+template <class Base, class Tag, size_t Size>
+template <class T>
+bool UniqueRegistry<Base, Tag, Size>::add(T* object, Tag tag)
+{
+	const uniq_t id = static_cast<const Unique*>(object)->id();
+
+	if (id >= Size || id == Unique::InvalidId || entries_[id].object)
+		return false;
+	entries_[id].object = object;
+	entries_[id].tag = tag;
+	++size_;
+
+	return true;
+}
+
+template <class Base, class Tag, size_t Size>
+bool UniqueRegistry<Base, Tag, Size>::remove(uniq_t id)
+{
+	if (!find(id))
+		return false;
+	entries_[id].object = nullptr;
+	--size_;
+
+	return true;
+}
+
+template <class Base, class Tag, size_t Size>
+Base* UniqueRegistry<Base, Tag, Size>::find(uniq_t id) const
+{
+	return id < Size ? entries_[id].object : nullptr;
+}
+
+template <class Base, class Tag, size_t Size>
+Base* UniqueRegistry<Base, Tag, Size>::find(uniq_t id, Tag tag) const
+{
+	return id < Size && entries_[id].tag == tag ? entries_[id].object : nullptr;
+}
+
+template <class Base, class Tag, size_t Size>
+const typename UniqueRegistry<Base, Tag, Size>::Entry* UniqueRegistry<Base, Tag, Size>::entry(uniq_t id) const
+{
+	return id < Size ? &entries_[id] : nullptr;
+}
+
+template <class Base, class Tag, size_t Size>
+typename UniqueRegistry<Base, Tag, Size>::size_type UniqueRegistry<Base, Tag, Size>::size() const
+{
+	return size_;
+}
+
+#endif // !defined UNIQUEREGISTRY_H__
@@ -148,7 +148,7 @@
 #include <Display.h>				// `Display' type.
 #include <AnalogKeypad.h>			// `Keypad' type.
 #include <DigitalClock.h>			// `DigitalClock' type.
-#include <TaskScheduler.h>			// `TaskScheduler' and `ClockCommand' types.
+#include <TaskScheduler.h>			// `TaskScheduler' type and `clockDelegate()' function.
 #include "config.h"					// Hardware and application configuration constants.
 
 //#define NOEEPROM 1				// Uncomment to skip deserialization when EEPROM data corrupted.
@@ -221,16 +221,11 @@ DigitalClock digital_clock(eeprom, (DigitalClock::Callback(&alarmCallback)));
  * Task Scheduling Objects *
  ***************************/
 
- // Poll keypad command.
-ClockCommand poll_keypad(keypad);
-// Refresh display command.
-ClockCommand refresh_display(display);
-// Check alarm command.
-ClockCommand check_alarm(digital_clock);
-// Scheduled tasks collection.
-TaskScheduler::Task keypad_task(&poll_keypad, KeypadPollingInterval, TaskScheduler::Task::State::Active);
-TaskScheduler::Task display_task(&refresh_display, DisplayRefreshInterval, TaskScheduler::Task::State::Active);
-TaskScheduler::Task alarm_task(&check_alarm, AlarmCheckingInterval, TaskScheduler::Task::State::Idle);
+// Scheduled tasks collection, each task clocks a component: polls the keypad, 
+// refreshes the display or checks the alarm.
+TaskScheduler::Task keypad_task(clockDelegate(keypad), KeypadPollingInterval, TaskScheduler::Task::State::Active);
+TaskScheduler::Task display_task(clockDelegate(display), DisplayRefreshInterval, TaskScheduler::Task::State::Active);
+TaskScheduler::Task alarm_task(clockDelegate(digital_clock), AlarmCheckingInterval, TaskScheduler::Task::State::Idle);
 TaskScheduler::Task* scheduled_tasks[] = 
 { 
 	&keypad_task, & display_task, & alarm_task
@@ -222,7 +222,7 @@ void adjustWrap(int8_t);
 void adjustInitAngle(int8_t);
 void adjustComms(const Display::Field&, int8_t);
 void listEvents(const sequence_type&);
-void storeEvents(const char*);
+void storeEvents(std_string_view);
 void initEvent(event_type&, char*, char*);
 void loadSequence(sequence_type&);
 void storeSequence(const sequence_type&);
@@ -319,19 +319,14 @@ config_t config(ServoDfltStepSize, ServoDfltStepInterval, servo_init_angle, fals
 RotaryActuator actuator(servo, &actuatorCallback);
 Sequencer sequencer(nullptr, nullptr, &sequencerCallback, true);
 
-/* Task scheduling objects, each ClockCommand is executed by the TaskScheduler 
-   according to its scheduling interval and state. */
-
-ClockCommand keypad_clock(keypad);
-ClockCommand display_clock(display);
-ClockCommand sequencer_clock(sequencer);
-ClockCommand actuator_clock(actuator);
-ClockCommand serial_clock(serial_remote);
-TaskScheduler::Task keypad_task(&keypad_clock, KeypadPollingInterval, TaskScheduler::Task::State::Active);
-TaskScheduler::Task display_task(&display_clock, DisplayRefreshInterval, TaskScheduler::Task::State::Active);
-TaskScheduler::Task sequencer_task(&sequencer_clock, SequencerClockingInterval, TaskScheduler::Task::State::Idle);
-TaskScheduler::Task actuator_task(&actuator_clock, ServoDfltStepInterval, TaskScheduler::Task::State::Idle);
-TaskScheduler::Task serial_task(&serial_clock, SerialPollingInterval, TaskScheduler::Task::State::Active);
+/* Task scheduling objects, each task's delegate clocks a component and is called 
+   by the TaskScheduler according to its scheduling interval and state. */
+
+TaskScheduler::Task keypad_task(clockDelegate(keypad), KeypadPollingInterval, TaskScheduler::Task::State::Active);
+TaskScheduler::Task display_task(clockDelegate(display), DisplayRefreshInterval, TaskScheduler::Task::State::Active);
+TaskScheduler::Task sequencer_task(clockDelegate(sequencer), SequencerClockingInterval, TaskScheduler::Task::State::Idle);
+TaskScheduler::Task actuator_task(clockDelegate(actuator), ServoDfltStepInterval, TaskScheduler::Task::State::Idle);
+TaskScheduler::Task serial_task(clockDelegate(serial_remote), SerialPollingInterval, TaskScheduler::Task::State::Active);
 TaskScheduler::Task* tasks[] = { &keypad_task, &display_task, &sequencer_task, &actuator_task, &serial_task };
 TaskScheduler task_scheduler(tasks);
 
@@ -345,6 +340,8 @@ event_type _events[MaxEventRecords * 2U];
 event_type* events[MaxEventRecords * 2U];
 sequence_type tmp_events;
 // Needs an MMU, of sorts, to realloc memory.
+char scratch_buf[ScratchBufferSize];
+std_arena scratch(scratch_buf); // Temporaries for serial command handlers.
 
 /*
  * Application state objects.
@@ -711,7 +708,7 @@ void serialCallback(CommandTag tag)
 		listEvents(sequencer.events());
 		break;
 	case CommandTag::Store:
-		storeEvents(serial_remote.buf());
+		storeEvents(serial_remote.text());
 		break;
 	default:
 		break;
@@ -1032,48 +1029,56 @@ void adjustComms(const Display::Field& field, int8_t adjustment)
 
 void listEvents(const sequence_type& sequence)
 {
-	char d[9]; // itoa/ltoa conversion buffer.
-
-	serial_remote.buf()[0] = '\0';
-	// Assemble a string of event parameters and send it to the serial buffer for transmission.
+	// Assemble the listing in scratch memory so the received command is left intact.
+	std_arena_scope scope(scratch);
+	char* d = scratch.allocate<char>(9U); // itoa/ltoa conversion buffer.
+	char* buf = scratch.allocate<char>(sequence.size() * MaxCharsPerRecord + 2U);
+
+	if (!d || !buf)
+		return;
+	buf[0] = '\0';
+	// Assemble a string of event parameters and send it to the serial port.
 	for (auto& it : sequence)
 	{
-		charcat(serial_remote.buf(), StringDelimiterChar);
-		strcat(serial_remote.buf(), it->name_);
-		charcat(serial_remote.buf(), StringDelimiterChar);
-		charcat(serial_remote.buf(), GroupSeparatorChar);
-		strcat(serial_remote.buf(), ltoa(it->duration_, d, DecimalRadix));
-		charcat(serial_remote.buf(), GroupSeparatorChar);
-		strcat(serial_remote.buf(), itoa(static_cast<actuator_command_type*>(it->command_)->angle(), d, DecimalRadix));
-		charcat(serial_remote.buf(), RecordSeparatorChar);
+		charcat(buf, StringDelimiterChar);
+		strcat(buf, it->name_);
+		charcat(buf, StringDelimiterChar);
+		charcat(buf, GroupSeparatorChar);
+		strcat(buf, ltoa(it->duration_, d, DecimalRadix));
+		charcat(buf, GroupSeparatorChar);
+		strcat(buf, itoa(static_cast<actuator_command_type*>(it->command_)->angle(), d, DecimalRadix));
+		charcat(buf, RecordSeparatorChar);
 	}
-	charcat(serial_remote.buf(), SerialRemote::EndOfTextChar);
-	Serial.print(serial_remote.buf());
+	charcat(buf, SerialRemote::EndOfTextChar);
+	Serial.print(buf);
 }
 
-void storeEvents(const char* buf)
+void storeEvents(std_string_view text)
 {
-	char* start = (char*)buf + strlen(SerialStoreString), * from = start, * to = nullptr;
+	// The received text's length is already known, so records are found without rescanning it.
+	std_string_view records = text.substr(SerialStoreString.size());
+	char* start = const_cast<char*>(records.data());
+	std_string_view::size_type from = 0, to = 0;
 	uint8_t n = 0;
 
 	// Parse characters in the serial buffer and create a collection of sequencer events
 	// equal to the number of event strings received.
-	while ((to = strchr(from, RecordSeparatorChar)))
+	while ((to = records.find(RecordSeparatorChar, from)) != std_string_view::npos)
 	{
 		if (++n == MaxEventRecords)
 			break;
-		from = ++to;
+		from = to + 1;
 	}
 
 	// Store the sequence in the EEPROM
 	eeprom.reset();
 	eeprom << n;
 	tmp_events = sequence_type(&events[0], n); // Alloc new sequence from event[0].
-	from = start;
+	from = 0;
 	n = 0;
-	while ((to = strchr(from, RecordSeparatorChar)))
+	while ((to = records.find(RecordSeparatorChar, from)) != std_string_view::npos)
 	{
-		initEvent(*tmp_events[n], from, to);
+		initEvent(*tmp_events[n], start + from, start + to);
 		if (++n == MaxEventRecords)
 			break;
 		from = to + 1;
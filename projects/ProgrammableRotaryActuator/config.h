@@ -31,6 +31,7 @@
 # define CONFIG_H__ 20210718L
 
 #include <utility.h>		// `std_pair' type.
+#include <arena.h>			// `std_arena' type.
 #include <utils.h>			// `resetFunc', `Print', `PrintLn', `charcat' functions.
 #include <chrono.h>			// Time & date lib.
 #include <AnalogKeypad.h>	// `Keypad' type.
@@ -76,12 +77,12 @@ const char NoWrapChar = 'N';
 const char StringDelimiterChar = '"';
 const char GroupSeparatorChar = ',';
 const char RecordSeparatorChar = ';';
-const char* SerialStartString = "srt";	// Sequencer start cmd.
-const char* SerialStopString = "stp";	// Sequencer stop cmd.
-const char* SerialResumeString = "res";	// Sequencer resume cmd.
-const char* SerialResetString = "rst";	// Sequencer reset cmd.
-const char* SerialListString = "lst";	// Sequencer list events cmd.
-const char* SerialStoreString = "sto";	// Sequencer store events cmd.
+constexpr std_string_view SerialStartString = "srt";	// Sequencer start cmd.
+constexpr std_string_view SerialStopString = "stp";	// Sequencer stop cmd.
+constexpr std_string_view SerialResumeString = "res";	// Sequencer resume cmd.
+constexpr std_string_view SerialResetString = "rst";	// Sequencer reset cmd.
+constexpr std_string_view SerialListString = "lst";	// Sequencer list events cmd.
+constexpr std_string_view SerialStoreString = "sto";	// Sequencer store events cmd.
 
 /*
  * Display row/col coordinates.
@@ -387,6 +388,7 @@ const uint8_t MaxEventRecords = 2;
 #endif
 const uint8_t MaxCharsPerRecord = 23;
 const uint8_t MaxLengthEventName = 7;
+const size_t ScratchBufferSize = MaxEventRecords * MaxCharsPerRecord + 16U;
 
 /*
  * Application Types